@@ -87,6 +87,10 @@
 	     (gc-cons-threshold alloc integer)
 	     (gc-cons-percentage alloc float)
 	     (garbage-collection-messages alloc boolean)
+	     (gc-idle-factor alloc
+			     (choice (const :tag "Never" nil)
+				     (integer :tag "Factor"))
+			     "32.1")
 	     ;; buffer.c
 	     (cursor-type display ,cursor-type-types)
 	     (mode-line-format mode-line sexp) ;Hard to do right.
@@ -399,6 +399,7 @@ regardless if `funcall' would accept to call them."
 
 (cl--define-built-in-type obarray atom)
 (cl--define-built-in-type native-comp-unit atom)
+(cl--define-built-in-type compiled-regexp atom)
 
 (cl--define-built-in-type sequence t "Abstract supertype of sequences.")
 (cl--define-built-in-type list sequence)
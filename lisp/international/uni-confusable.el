@@ -0,0 +1,24 @@
+;;; uni-confusable.el --- automatically generated (do not edit)   -*- lexical-binding: t -*-
+;; Generated by the `unidata-gen-charprop' function.
+
+;; This file is part of GNU Emacs.
+
+;;; Commentary:
+
+;; See the admin/unidata/ directory in the Emacs sources.
+
+;;; Code:
+
+(defconst uni-confusable-table
+#s(hash-table data (1453 "֖" 1454 "֘" 1448 "֙" 1444 "֚" 6836 "ۛ" 8411 "ۛ" 1561 "̓" 2291 "̓" 835 "̓" 789 "̓" 1615 "̓" 1629 "̔" 1436 "́" 1437 "́" 1560 "́" 1863 "́" 833 "́" 2388 "́" 1614 "́" 832 "̀" 2387 "̀" 780 "̆" 42620 "̆" 1624 "̆" 1626 "̆" 878 "̆" 2373 "̆" 72550 "̆" 1768 "̆̇" 784 "̆̇" 2305 "̆̇" 2433 "̆̇" 2689 "̆̇" 2817 "̆̇" 3072 "̆̇" 3201 "̆̇" 3329 "̆̇" 70847 "̆̇" 7376 "̂" 785 "̂" 1627 "̂" 2030 "̂" 42736 "̂" 1455 "̊" 1759 "̊" 6099 "̊" 12442 "̊" 1618 "̊" 2946 "̊" 4150 "̊" 6086 "̊" 70400 "̊" 3661 "̊" 3789 "̊" 870 "̊" 11754 "̊" 2283 "̈" 2035 "̈" 1611 "̋" 2288 "̋" 834 "̃" 1619 "̃" 1476 "̇" 1772 "̇" 1856 "̇" 2282 "̇" 1857 "̇" 856 "̇" 1465 "̇" 1466 "̇" 1474 "̇" 1473 "̇" 2029 "̇" 2306 "̇" 2562 "̇" 2690 "̇" 3021 "̇" 823 "̸" 6839 "̨" 802 "̨" 837 "̨" 7378 "̄" 773 "̄" 1625 "̄" 2027 "̄" 42737 "̄" 6882 "̄" 6888 "̄̄" 7386 "̎" 1623 "̒" 855 "͐" 2303 "͐" 2296 "͐" 2304 "͒" 6873 "᫆" 124654 "᫈" 7405 "̖" 7388 "̩" 1622 "̩" 7381 "̫" 839 "̳" 2297 "͔" 2298 "͕" 12443 "ﾞ" 12444 "ﾟ" 822 "̵" 12332 "̉" 1477 "̣" 2285 "̣" 7389 "̣" 1460 "̣" 1628 "̣" 2364 "̣" 2492 "̣" 2620 "̣" 2748 "̣" 2876 "̣" 70090 "̣" 70851 "̣" 68154 "̣" 2286 "̤" 7390 "̤" 3895 "̥" 12333 "̥" 807 "̦" 801 "̦" 825 "̦" 7385 "̭" 7384 "̮" 2386 "̱" 800 "̱" 2289 "ٌ" 2280 "ٌ" 2277 "ٌ" 64606 "ﹲّ" 2290 "ٍ" 64607 "ﹴّ" 64754 "ﹷّ" 64608 "ﹶّ" 64755 "ﹹّ" 64609 "ﹸّ" 1562 "ِ" 791 "ِ" 64756 "ﹻّ" 64610 "ﹺّ" 64611 "ﹼٰ" 1631 "ٕ" 781 "ٰ" 1858 "ܼ" 2563 "ঃ" 3075 "ঃ" 3203 "ঃ" 3331 "ঃ" 3459 "ঃ" 4152 "ঃ" 70849 "ঃ" 6091 "่" 3784 "่" 3785 "้" 3786 "๊" 3787 "๋" 42607 "⃩" 8232 " " 8233 " " 5760 " " 8192 " " 8193 " " 8194 " " 8195 " " 8196 " " 8197 " " 8198 " " 8200 " " 8201 " " 8202 " " 8287 " " 160 " " 8199 " " 8239 " " 2042 "_" 65101 "_" 65102 "_" 65103 "_" 8208 "-" 8209 "-" 8210 "-" 8211 "-" 65112 "-" 1748 "-" 8259 "-" 727 "-" 8722 "-" 10134 "-" 11451 "-" 11450 "-" 10793 "-̓" 11802 "-̈" 64297 "-̇" 8760 "-̇" 11443 "-̇" 11442 "-̇" 10794 "-̣" 42238 "-." 65374 "〜" 1549 "," 1643 "," 8218 "," 184 "," 42233 "," 11826 "،" 1644 "،" 894 ";" 11829 "؛" 2307 ":" 2691 ":" 65306 ":" 1417 ":" 1795 ":" 1796 ":" 5868 ":" 65072 ":" 6147 ":" 6153 ":" 8282 ":" 1475 ":" 760 ":" 42889 ":" 8758 ":" 720 ":" 42237 ":" 73177 ":" 10868 "::=" 10740 ":→" 65281 "!" 451 "!" 11601 "!" 8252 "!!" 8265 "!?" 660 "?" 577 "?" 2429 "?" 5038 "?" 42731 "?" 8264 "?!" 8263 "??" 11822 "؟" 119149 "." 8228 "." 1793 "." 1794 "." 42510 "." 68176 "." 1632 "." 1776 "." 42232 "." 42235 ".," 8229 ".." 42234 ".." 8230 "..." 42740 "꛳꛳" 12539 "·" 65381 "·" 5867 "·" 903 "·" 11825 "·" 65793 "·" 8226 "·" 8231 "·" 8729 "·" 8901 "·" 42895 "·" 5159 "·" 8943 "···" 11592 "···" 5188 "·<" 8919 "·>" 5175 "·>" 5184 "·>" 5423 "·4" 5246 "·b" 5248 "·ḃ" 5242 "·d" 5272 "·J" 5302 "·L" 5238 "·P" 5207 "·U" 5178 "·V" 5180 "·Ʌ" 5294 "·Γ" 5134 "·Δ" 5209 "·Ո" 5132 "·ᐁ" 5136 "·ᐄ" 5138 "·ᐅ" 5140 "·ᐆ" 5143 "·ᐊ" 5145 "·ᐋ" 5182 "·ᐲ" 5186 "·ᐴ" 5190 "·ᐹ" 5211 "·ᑏ" 5204 "·ᑐ" 5213 "·ᑐ" 5215 "·ᑑ" 5217 "·ᑕ" 5219 "·ᑖ" 5236 "·ᑫ" 5240 "·ᑮ" 5244 "·ᑰ" 5266 "·ᒉ" 5268 "·ᒋ" 5270 "·ᒌ" 5274 "·ᒎ" 5276 "·ᒐ" 5278 "·ᒑ" 5292 "·ᒣ" 5296 "·ᒦ" 5298 "·ᒧ" 5300 "·ᒨ" 5304 "·ᒫ" 5321 "·ᓀ" 6342 "·ᓂ" 6344 "·ᓃ" 6346 "·ᓄ" 6348 "·ᓅ" 5323 "·ᓇ" 5325 "·ᓈ" 5340 "·ᓓ" 5342 "·ᓕ" 5344 "·ᓖ" 5346 "·ᓗ" 5348 "·ᓘ" 5350 "·ᓚ" 5352 "·ᓛ" 5366 "·ᓭ" 5368 "·ᓯ" 5370 "·ᓰ" 5372 "·ᓱ" 5374 "·ᓲ" 5376 "·ᓴ" 5378 "·ᓵ" 5399 "·ᔐ" 5401 "·ᔑ" 5403 "·ᔒ" 5405 "·ᔓ" 5407 "·ᔔ" 5409 "·ᔕ" 5411 "·ᔖ" 5425 "·ᔨ" 5427 "·ᔩ" 5429 "·ᔪ" 5431 "·ᔫ" 5433 "·ᔭ" 5435 "·ᔮ" 6350 "·ᕃ" 6351 "·ᕆ" 6352 "·ᕇ" 6353 "·ᕈ" 6354 "·ᕉ" 6355 "·ᕋ" 5454 "·ᕌ" 5467 "·ᕚ" 5480 "·ᕧ" 6323 "·ᢱ" 6326 "·ᢴ" 6329 "·ᢸ" 6338 "·ᣀ" 43056 "।" 2405 "।।" 7228 "᰻᰻" 4171 "၊၊" 6825 "᪨᪨" 6827 "᪪᪨" 7007 "᭞᭞" 68183 "𐩖𐩖" 70732 "𑑋𑑋" 71234 "𑙁𑙁" 72770 "𑱁𑱁" 7295 "᱾᱾" 1373 "'" 65287 "'" 8216 "'" 8217 "'" 8219 "'" 1523 "'" 8242 "'" 8245 "'" 1370 "'" 96 "'" 8175 "'" 65344 "'" 180 "'" 900 "'" 8189 "'" 8125 "'" 8127 "'" 8190 "'" 697 "'" 884 "'" 712 "'" 714 "'" 715 "'" 756 "'" 699 "'" 701 "'" 700 "'" 702 "'" 42892 "'" 1497 "'" 2036 "'" 2037 "'" 5194 "'" 5836 "'" 94033 "'" 94034 "'" 7379 "''" 34 "''" 65282 "''" 8220 "''" 8221 "''" 8223 "''" 1524 "''" 8243 "''" 8246 "''" 12291 "''" 733 "''" 698 "''" 758 "''" 750 "''" 1522 "''" 8244 "'''" 8247 "'''" 8279 "''''" 385 "'B" 394 "'D" 329 "'n" 420 "'P" 428 "'T" 435 "'Y" 65339 "(" 10088 "(" 10098 "(" 12308 "(" 64830 "(" 11816 "((" 12832 "(ー)" 9333 "(2)" 9351 "(2O)" 9334 "(3)" 9335 "(4)" 9336 "(5)" 9337 "(6)" 9338 "(7)" 9339 "(8)" 9340 "(9)" 9372 "(a)" 127248 "(A)" 9373 "(b)" 127249 "(B)" 9374 "(c)" 127250 "(C)" 9375 "(d)" 127251 "(D)" 9376 "(e)" 127252 "(E)" 9377 "(f)" 127253 "(F)" 9378 "(g)" 127254 "(G)" 9379 "(h)" 127255 "(H)" 9380 "(i)" 9381 "(j)" 127257 "(J)" 9382 "(k)" 127258 "(K)" 9332 "(l)" 127256 "(l)" 9383 "(l)" 127259 "(L)" 9343 "(l2)" 9344 "(l3)" 9345 "(l4)" 9346 "(l5)" 9347 "(l6)" 9348 "(l7)" 9349 "(l8)" 9350 "(l9)" 9342 "(ll)" 9341 "(lO)" 127260 "(M)" 9385 "(n)" 127261 "(N)" 9386 "(o)" 127262 "(O)" 9387 "(p)" 127263 "(P)" 9388 "(q)" 127264 "(Q)" 9389 "(r)" 127265 "(R)" 9384 "(rn)" 9390 "(s)" 127266 "(S)" 127274 "(S)" 9391 "(t)" 127267 "(T)" 9392 "(u)" 127268 "(U)" 9393 "(v)" 127269 "(V)" 9394 "(w)" 127270 "(W)" 9395 "(x)" 127271 "(X)" 9396 "(y)" 127272 "(Y)" 9397 "(z)" 127273 "(Z)" 12800 "(ᄀ)" 12814 "(가)" 12801 "(ᄂ)" 12815 "(나)" 12802 "(ᄃ)" 12816 "(다)" 12803 "(ᄅ)" 12817 "(라)" 12804 "(ᄆ)" 12818 "(마)" 12805 "(ᄇ)" 12819 "(바)" 12806 "(ᄉ)" 12820 "(사)" 12807 "(ᄋ)" 12821 "(아)" 12829 "(오전)" 12830 "(오후)" 12808 "(ᄌ)" 12822 "(자)" 12828 "(주)" 12809 "(ᄎ)" 12823 "(차)" 12810 "(ᄏ)" 12824 "(카)" 12811 "(ᄐ)" 12825 "(타)" 12812 "(ᄑ)" 12826 "(파)" 12813 "(ᄒ)" 12827 "(하)" 12838 "(七)" 12834 "(三)" 127553 "(三)" 12840 "(九)" 12833 "(二)" 127554 "(二)" 12836 "(五)" 12857 "(代)" 12861 "(企)" 12865 "(休)" 12839 "(八)" 12837 "(六)" 12856 "(労)" 127559 "(勝)" 12841 "(十)" 12863 "(協)" 12852 "(名)" 12858 "(呼)" 12835 "(四)" 12847 "(土)" 12859 "(学)" 127555 "(安)" 127557 "(打)" 127560 "(敗)" 12848 "(日)" 12842 "(月)" 12850 "(有)" 12845 "(木)" 127552 "(本)" 12849 "(株)" 12844 "(水)" 12843 "(火)" 127556 "(点)" 12853 "(特)" 127558 "(盗)" 12860 "(監)" 12851 "(社)" 12855 "(祝)" 12864 "(祭)" 12866 "(自)" 12867 "(至)" 12854 "(財)" 12862 "(資)" 12846 "(金)" 65341 ")" 10089 ")" 10099 ")" 12309 ")" 64831 ")" 11817 "))" 10100 "{" 119060 "{" 10101 "}" 12314 "⟦" 12315 "⟧" 10216 "❬" 9001 "❬" 12296 "❬" 12763 "❬" 12367 "❬" 139240 "❬" 10217 "❭" 9002 "❭" 12297 "❭" 65342 "︿" 11839 "¶" 8270 "*" 1645 "*" 8727 "*" 66335 "*" 5941 "/" 8257 "/" 8725 "/" 8260 "/" 9585 "/" 10187 "/" 10744 "/" 119354 "/" 12755 "/" 12339 "/" 11463 "/" 11462 "/" 12494 "/" 20031 "/" 12035 "/" 10742 "/̄" 11005 "//" 11003 "///" 65340 "\\" 65128 "\\" 8726 "\\" 10189 "\\" 10741 "\\" 10745 "\\" 119311 "\\" 119355 "\\" 12756 "\\" 20022 "\\" 12034 "\\" 11513 "\\\\" 9290 "\\\\" 10184 "\\ᑕ" 42872 "&" 2800 "॰" 69819 "॰" 70087 "॰" 9900 "॰" 70107 "꣼" 6105 "๏" 6101 "๚" 6106 "๛" 3852 "་" 3854 "།།" 708 "^" 710 "^" 42622 "ˇ" 728 "ˇ" 8254 "ˉ" 65097 "ˉ" 65098 "ˉ" 65099 "ˉ" 65100 "ˉ" 175 "ˉ" 65507 "ˉ" 9620 "ˉ" 1098 "ˉb" 42577 "ˉbi" 885 "ˏ" 763 "˪" 42774 "˪" 42772 "˫" 12290 "˳" 11824 "°" 730 "°" 8728 "°" 9675 "°" 9702 "°" 9052 "°̲" 69328 "°̲" 9060 "°̈" 8451 "°C" 8457 "°F" 3061 "௳" 3867 "༚༚" 3871 "༚༝" 4046 "༝༚" 3870 "༝༝" 9400 "©" 9415 "®" 9413 "℗" 119323 "⅄" 11244 "↞" 11245 "↟" 11246 "↠" 11247 "↡" 8629 "↲" 10597 "⇃⇂" 10607 "⇃ᛚ" 120539 "∂" 120597 "∂" 120655 "∂" 120713 "∂" 120771 "∂" 125132 "∂" 125133 "∂̵" 240 "∂̵" 8960 "∅" 120513 "∇" 120571 "∇" 120629 "∇" 120687 "∇" 120745 "∇" 71848 "∇" 9058 "∇̈" 9067 "∇̴" 9608 "∎" 9632 "∎" 10815 "∐" 5869 "+" 10133 "+" 66203 "+" 124649 "+" 10787 "+̂" 10786 "+̊" 10788 "+̃" 8724 "+̇" 10789 "+̣" 10790 "+̰" 10791 "+₂" 10135 "÷" 8249 "<" 10094 "<" 706 "<" 119350 "<" 5176 "<" 5810 "<" 8918 "<·" 11445 "<·" 11444 "<·" 5189 "<·" 8810 "<<" 8920 "<<<" 5120 "=" 11840 "=" 12448 "=" 42239 "=" 8794 "=̆" 8793 "=̂" 8791 "=̊" 8784 "=̇" 8785 "=̣̇" 11158 "=᪲" 10862 "=⃰" 10869 "==" 10870 "===" 8798 "=ͫ" 8250 ">" 10095 ">" 707 ">" 119351 ">" 5171 ">" 94015 ">" 5185 ">·" 10917 "><" 8811 ">>" 10784 ">>" 8921 ">>>" 8275 "~" 732 "~" 8128 "~" 8764 "~" 9064 "~̈" 11806 "~̇" 10858 "~̇" 11807 "~̣" 125128 "∠" 8896 "∧" 8751 "∮∮" 8752 "∮∮∮" 11819 "∴" 11818 "∵" 11820 "∷" 70110 "≈" 9806 "≏" 128862 "≏" 8803 "≡" 11447 "≡" 10755 "⊍" 10756 "⊎" 119352 "⊏" 119353 "⊐" 10757 "⊓" 10758 "⊔" 10754 "⊗" 9055 "⊛" 128881 "⊠" 128853 "⊡" 9665 "⊲" 9655 "⊳" 9059 "⋆̈" 65076 "⌇" 9696 "⌒" 10813 "⌙" 8997 "⌤" 10695 "⌻" 9678 "⌾" 10686 "⌾" 10693 "⍂" 10672 "⍉" 9155 "⍋" 9154 "⍎" 9153 "⍕" 9158 "⍭" 9784 "⎈" 65077 "⏜" 65078 "⏝" 65079 "⏞" 65080 "⏟" 65081 "⏠" 65082 "⏡" 9649 "⏥" 9212 "⏻" 65073 "│" 65372 "│" 9475 "│" 9487 "┌" 9507 "├" 9616 "▌" 9623 "▖" 9629 "▘" 9744 "□" 65517 "▪" 9656 "▶" 9658 "▶" 11497 "☧" 128778 "☩" 127762 "☽" 127769 "☽" 9214 "☾" 127768 "☾" 10713 "⦚" 128826 "⧟" 10814 "⨟" 9833 "𝅘𝅥" 9834 "𝅘𝅥𝅮" 9450 "🄍" 8634 "🄎" 118011 "🛸" 729 "ॱ" 3406 "ॱ" 65293 "ー" 8212 "ー" 8213 "ー" 9472 "ー" 9473 "ー" 12752 "ー" 42999 "ー" 4467 "ー" 12641 "ー" 19968 "ー" 12032 "ー" 4502 "ーー" 55225 "ーᅡ" 55226 "ーᅥ" 55227 "ーᅥ丨" 55228 "ーᅩ" 4501 "ーᅮ" 4468 "ー丨" 12642 "ー丨" 4503 "ー丨ᅮ" 127247 "$⃠" 8356 "£" 12306 "₸" 12342 "₸" 7004 "᭐" 43462 "꧐" 70865 "১" 3303 "౧" 4197 "၁" 9312 "➀" 9321 "➉" 9192 "₁₀" 118002 "2" 120784 "2" 120794 "2" 120804 "2" 120814 "2" 120824 "2" 130034 "2" 42842 "2" 423 "2" 1000 "2" 42564 "2" 5311 "2" 42735 "2" 43471 "٢" 1778 "٢" 2792 "२" 2736 "२" 70866 "২" 3304 "౨" 9313 "➁" 443 "2̵" 127235 "2," 9353 "2." 13301 "22日" 13166 "22点" 13302 "23日" 13167 "23点" 13303 "24日" 13168 "24点" 13304 "25日" 13305 "26日" 13306 "27日" 13307 "28日" 13308 "29日" 13300 "2l日" 13165 "2l点" 9371 "2O." 13299 "2O日" 13164 "2O点" 3561 "෨ා" 3567 "෨ී" 13281 "2日" 12993 "2月" 13146 "2点" 119302 "3" 2409 "3" 2793 "3" 118003 "3" 120785 "3" 120795 "3" 120805 "3" 120815 "3" 120825 "3" 130035 "3" 42923 "3" 540 "3" 439 "3" 42858 "3" 11420 "3" 11460 "3" 11468 "3" 1047 "3" 1248 "3" 94011 "3" 71882 "3" 1779 "٣" 125129 "٣" 9314 "➂" 1176 "3̦" 127236 "3," 9354 "3." 13310 "3l日" 13309 "3O日" 13282 "3日" 12994 "3月" 13147 "3点" 118004 "4" 120786 "4" 120796 "4" 120806 "4" 120816 "4" 120826 "4" 130036 "4" 5070 "4" 71855 "4" 1780 "٤" 2794 "४" 9315 "➃" 127237 "4," 9355 "4." 5424 "4·" 13283 "4日" 12995 "4月" 13148 "4点" 118005 "5" 120787 "5" 120797 "5" 120807 "5" 120817 "5" 120827 "5" 130037 "5" 444 "5" 71867 "5" 9316 "➄" 127238 "5," 9356 "5." 13284 "5日" 12996 "5月" 13149 "5点" 118006 "6" 120788 "6" 120798 "6" 120808 "6" 120818 "6" 120828 "6" 130038 "6" 11475 "6" 11474 "6" 1004 "6" 11484 "6" 1073 "6" 5102 "6" 71893 "6" 1782 "٦" 70870 "৬" 9317 "➅" 127239 "6," 9357 "6." 13285 "6日" 12997 "6月" 13150 "6点" 119314 "7" 118007 "7" 120789 "7" 120799 "7" 120809 "7" 120819 "7" 120829 "7" 130039 "7" 66770 "7" 71878 "7" 9318 "➆" 127240 "7," 9358 "7." 13286 "7日" 12998 "7月" 13151 "7点" 2819 "8" 2538 "8" 2666 "8" 125131 "8" 118008 "8" 120790 "8" 120800 "8" 120810 "8" 120820 "8" 120830 "8" 130040 "8" 547 "8" 546 "8" 66330 "8" 2798 "८" 9319 "➇" 127241 "8," 9359 "8." 13287 "8日" 12999 "8月" 13152 "8点" 2663 "9" 2920 "9" 2541 "9" 3437 "9" 118009 "9" 120791 "9" 120801 "9" 120811 "9" 120821 "9" 120831 "9" 130041 "9" 42862 "9" 11467 "9" 11466 "9" 71884 "9" 71852 "9" 71894 "9" 2407 "٩" 71908 "٩" 1785 "٩" 3311 "౯" 9320 "➈" 127242 "9," 9360 "9." 13288 "9日" 13000 "9月" 13153 "9点" 9082 "a" 65345 "a" 119834 "a" 119886 "a" 119938 "a" 119990 "a" 120042 "a" 120094 "a" 120146 "a" 120198 "a" 120250 "a" 120302 "a" 120354 "a" 120406 "a" 120458 "a" 593 "a" 945 "a" 120514 "a" 120572 "a" 120630 "a" 120688 "a" 120746 "a" 1072 "a" 11766 "ͣ" 65313 "A" 117974 "A" 119808 "A" 119860 "A" 119912 "A" 119964 "A" 120016 "A" 120068 "A" 120120 "A" 120172 "A" 120224 "A" 120276 "A" 120328 "A" 120380 "A" 120432 "A" 913 "A" 120488 "A" 120546 "A" 120604 "A" 120662 "A" 120720 "A" 1040 "A" 5034 "A" 5573 "A" 42222 "A" 94016 "A" 66208 "A" 9078 "a̲" 462 "ă" 461 "Ă" 551 "å" 550 "Å" 7834 "ả" 8448 "a/c" 8449 "a/s" 42803 "aa" 42802 "AA" 230 "ae" 1237 "ae" 198 "AE" 1236 "AE" 42805 "ao" 42804 "AO" 128775 "AR" 42807 "au" 42806 "AU" 42809 "av" 42811 "av" 42808 "AV" 42810 "AV" 42813 "ay" 42812 "AY" 43898 "ᴀ" 8704 "Ɐ" 119319 "Ɐ" 5572 "Ɐ" 42223 "Ɐ" 66591 "Ɒ" 119835 "b" 119887 "b" 119939 "b" 119991 "b" 120043 "b" 120095 "b" 120147 "b" 120199 "b" 120251 "b" 120303 "b" 120355 "b" 120407 "b" 120459 "b" 388 "b" 1068 "b" 5071 "b" 5234 "b" 5551 "b" 93878 "b" 65314 "B" 8492 "B" 117975 "B" 119809 "B" 119861 "B" 119913 "B" 120017 "B" 120069 "B" 120121 "B" 120173 "B" 120225 "B" 120277 "B" 120329 "B" 120381 "B" 120433 "B" 42932 "B" 914 "B" 120489 "B" 120547 "B" 120605 "B" 120663 "B" 120721 "B" 11394 "B" 1042 "B" 5108 "B" 5623 "B" 42192 "B" 66178 "B" 66209 "B" 66305 "B" 595 "b̔" 5235 "ḃ" 387 "b̄" 386 "b̄" 1041 "b̄" 384 "b̵" 1165 "b̵" 1164 "b̵" 1123 "b̵" 1122 "b̵" 5247 "b·" 5249 "ḃ·" 5256 "b'" 1067 "bl" 11395 "ʙ" 1074 "ʙ" 5116 "ʙ" 65347 "c" 8573 "c" 119836 "c" 119888 "c" 119940 "c" 119992 "c" 120044 "c" 120096 "c" 120148 "c" 120200 "c" 120252 "c" 120304 "c" 120356 "c" 120408 "c" 120460 "c" 7428 "c" 1010 "c" 11429 "c" 1089 "c" 4100 "c" 4186 "c" 43951 "c" 66621 "c" 11757 "ͨ" 128844 "C" 71913 "C" 71922 "C" 65315 "C" 8557 "C" 8450 "C" 8493 "C" 117976 "C" 119810 "C" 119862 "C" 119914 "C" 119966 "C" 120018 "C" 120174 "C" 120226 "C" 120278 "C" 120330 "C" 120382 "C" 120434 "C" 1017 "C" 11428 "C" 1057 "C" 5087 "C" 42202 "C" 66210 "C" 66306 "C" 66581 "C" 66844 "C" 162 "c̸" 572 "c̸" 8353 "C⃫" 127342 "C⃠" 231 "c̦" 1195 "c̦" 199 "C̦" 1194 "C̦" 391 "C'" 8453 "c/o" 8454 "c/u" 127341 "㏄	⃝" 8948 "ꞓ" 603 "ꞓ" 949 "ꞓ" 1013 "ꞓ" 120518 "ꞓ" 120540 "ꞓ" 120576 "ꞓ" 120598 "ꞓ" 120634 "ꞓ" 120656 "ꞓ" 120692 "ꞓ" 120714 "ꞓ" 120750 "ꞓ" 120772 "ꞓ" 11401 "ꞓ" 1108 "ꞓ" 1297 "ꞓ" 43931 "ꞓ" 71886 "ꞓ" 66601 "ꞓ" 8364 "Ꞓ" 11400 "Ꞓ" 1028 "Ꞓ" 9079 "ꞓ̲" 893 "ꜿ" 1023 "Ꜿ" 8574 "d" 8518 "d" 119837 "d" 119889 "d" 119941 "d" 119993 "d" 120045 "d" 120097 "d" 120149 "d" 120201 "d" 120253 "d" 120305 "d" 120357 "d" 120409 "d" 120461 "d" 1281 "d" 5095 "d" 5231 "d" 42194 "d" 8558 "D" 8517 "D" 117977 "D" 119811 "D" 119863 "D" 119915 "D" 119967 "D" 120019 "D" 120071 "D" 120123 "D" 120175 "D" 120227 "D" 120279 "D" 120331 "D" 120383 "D" 120435 "D" 5024 "D" 5598 "D" 5610 "D" 42195 "D" 599 "d̔" 598 "d̨" 396 "d̄" 273 "d̵" 272 "D̵" 208 "D̵" 393 "D̵" 8363 "ḏ̵" 42874 "Ꝺ" 5243 "d·" 5255 "d'" 676 "dȝ" 499 "dz" 675 "dz" 498 "Dz" 497 "DZ" 454 "dž" 453 "Dž" 452 "DŽ" 677 "dʑ" 43888 "ᴅ" 11833 "ẟ" 948 "ẟ" 120517 "ẟ" 120575 "ẟ" 120633 "ẟ" 120691 "ẟ" 120749 "ẟ" 11485 "ẟ" 1390 "ẟ" 5495 "ẟ" 8494 "e" 65349 "e" 8495 "e" 8519 "e" 119838 "e" 119890 "e" 119942 "e" 120046 "e" 120098 "e" 120150 "e" 120202 "e" 120254 "e" 120306 "e" 120358 "e" 120410 "e" 120462 "e" 43826 "e" 1077 "e" 1213 "e" 11767 "ͤ" 8959 "E" 65317 "E" 8496 "E" 117978 "E" 119812 "E" 119864 "E" 119916 "E" 120020 "E" 120072 "E" 120124 "E" 120176 "E" 120228 "E" 120280 "E" 120332 "E" 120384 "E" 120436 "E" 917 "E" 120492 "E" 120550 "E" 120608 "E" 120666 "E" 120724 "E" 1045 "E" 11577 "E" 5036 "E" 42224 "E" 71846 "E" 71854 "E" 66182 "E" 283 "ĕ" 282 "Ĕ" 583 "e̸" 582 "E̸" 1215 "ę" 43900 "ᴇ" 601 "ǝ" 1241 "ǝ" 8707 "Ǝ" 11578 "Ǝ" 42225 "Ǝ" 602 "ǝ˞" 7444 "ǝo" 43841 "ǝo̸" 43842 "ǝo̵" 1240 "Ə" 119329 "Ɛ" 8455 "Ɛ" 1296 "Ɛ" 5067 "Ɛ" 93997 "Ɛ" 66561 "Ɛ" 7583 "ᵋ" 7432 "ɜ" 1079 "ɜ" 1177 "ɜ̦" 66626 "ɞ" 42909 "ʚ" 66602 "ʚ" 119839 "f" 119891 "f" 119943 "f" 119995 "f" 120047 "f" 120099 "f" 120151 "f" 120203 "f" 120255 "f" 120307 "f" 120359 "f" 120411 "f" 120463 "f" 43829 "f" 42905 "f" 402 "f" 383 "f" 7837 "f" 1412 "f" 119315 "F" 8497 "F" 117979 "F" 119813 "F" 119865 "F" 119917 "F" 120021 "F" 120073 "F" 120125 "F" 120177 "F" 120229 "F" 120281 "F" 120333 "F" 120385 "F" 120437 "F" 42904 "F" 988 "F" 120778 "F" 5556 "F" 42205 "F" 71874 "F" 71842 "F" 66183 "F" 66213 "F" 66853 "F" 401 "F̦" 7534 "f̴" 8507 "FAX" 64256 "ff" 64259 "ffi" 64260 "ffl" 64257 "fi" 64258 "fl" 681 "fn̩" 5557 "Ⅎ" 42206 "Ⅎ" 119344 "ꟻ" 5559 "ꟻ" 65351 "g" 8458 "g" 119840 "g" 119892 "g" 119944 "g" 120048 "g" 120100 "g" 120152 "g" 120204 "g" 120256 "g" 120308 "g" 120360 "g" 120412 "g" 120464 "g" 609 "g" 7555 "g" 397 "g" 1409 "g" 117980 "G" 119814 "G" 119866 "G" 119918 "G" 119970 "G" 120022 "G" 120074 "G" 120126 "G" 120178 "G" 120230 "G" 120282 "G" 120334 "G" 120386 "G" 120438 "G" 1292 "G" 5056 "G" 5107 "G" 42198 "G" 7586 "ᵍ" 608 "g̔" 487 "ğ" 486 "Ğ" 501 "ģ" 485 "g̵" 484 "G̵" 403 "G'" 1293 "ɢ" 43920 "ɢ" 5115 "ɢ" 65352 "h" 8462 "h" 119841 "h" 119945 "h" 119997 "h" 120049 "h" 120101 "h" 120153 "h" 120205 "h" 120257 "h" 120309 "h" 120361 "h" 120413 "h" 120465 "h" 1211 "h" 1392 "h" 5058 "h" 65320 "H" 8459 "H" 8460 "H" 8461 "H" 117981 "H" 119815 "H" 119867 "H" 119919 "H" 120023 "H" 120179 "H" 120231 "H" 120283 "H" 120335 "H" 120387 "H" 120439 "H" 919 "H" 120494 "H" 120552 "H" 120610 "H" 120668 "H" 120726 "H" 11406 "H" 1053 "H" 5051 "H" 5500 "H" 42215 "H" 66255 "H" 7544 "ᴴ" 614 "h̔" 42645 "h̔" 5106 "h̔" 11367 "H̩" 1186 "H̩" 295 "h̵" 8463 "h̵" 1115 "h̵" 294 "H̵" 1225 "H̦" 1223 "H̦" 11407 "ʜ" 1085 "ʜ" 43915 "ʜ" 1187 "ʜ̩" 1226 "ʜ̦" 1224 "ʜ̦" 1290 "Ƕ" 43904 "ⱶ" 880 "Ⱶ" 5032 "Ⱶ" 5040 "Ⱶ" 42673 "Ⱶ" 42901 "ꜧ" 731 "i" 9075 "i" 65353 "i" 8560 "i" 8505 "i" 8520 "i" 119842 "i" 119894 "i" 119946 "i" 119998 "i" 120050 "i" 120102 "i" 120154 "i" 120206 "i" 120258 "i" 120310 "i" 120362 "i" 120414 "i" 120466 "i" 305 "i" 120484 "i" 618 "i" 617 "i" 953 "i" 8126 "i" 890 "i" 120522 "i" 120580 "i" 120638 "i" 120696 "i" 120754 "i" 11411 "i" 1110 "i" 42567 "i" 1410 "i" 43893 "i" 5029 "i" 71875 "i" 9435 "Ⓘ" 9080 "i̲" 464 "ĭ" 463 "Ĭ" 616 "i̵" 7547 "i̵" 7548 "i̵" 8561 "ii" 8562 "iii" 307 "ij" 8563 "iv" 8568 "ix" 65354 "j" 8521 "j" 119843 "j" 119895 "j" 119947 "j" 119999 "j" 120051 "j" 120103 "j" 120155 "j" 120207 "j" 120259 "j" 120311 "j" 120363 "j" 120415 "j" 120467 "j" 1011 "j" 1112 "j" 65322 "J" 117983 "J" 119817 "J" 119869 "J" 119921 "J" 119973 "J" 120025 "J" 120077 "J" 120129 "J" 120181 "J" 120233 "J" 120285 "J" 120337 "J" 120389 "J" 120441 "J" 42930 "J" 895 "J" 1032 "J" 5035 "J" 5261 "J" 42201 "J" 585 "j̵" 584 "J̵" 5273 "J·" 120485 "ȷ" 1397 "ȷ" 43899 "ᴊ" 119844 "k" 119896 "k" 119948 "k" 120000 "k" 120052 "k" 120104 "k" 120156 "k" 120208 "k" 120260 "k" 120312 "k" 120364 "k" 120416 "k" 120468 "k" 8490 "K" 65323 "K" 117984 "K" 119818 "K" 119870 "K" 119922 "K" 119974 "K" 120026 "K" 120078 "K" 120130 "K" 120182 "K" 120234 "K" 120286 "K" 120338 "K" 120390 "K" 120442 "K" 922 "K" 120497 "K" 120555 "K" 120613 "K" 120671 "K" 120729 "K" 11412 "K" 1050 "K" 5094 "K" 5845 "K" 42199 "K" 66840 "K" 409 "k̔" 11369 "K̩" 1178 "K̩" 8365 "K̵" 42816 "K̵" 1182 "K̵" 408 "K'" 1472 "l" 124 "l" 8739 "l" 9213 "l" 65512 "l" 49 "l" 1633 "l" 1777 "l" 66336 "l" 125127 "l" 118001 "l" 120783 "l" 120793 "l" 120803 "l" 120813 "l" 120823 "l" 130033 "l" 73 "l" 65321 "l" 8544 "l" 8464 "l" 8465 "l" 117982 "l" 119816 "l" 119868 "l" 119920 "l" 120024 "l" 120128 "l" 120180 "l" 120232 "l" 120284 "l" 120336 "l" 120388 "l" 120440 "l" 406 "l" 65356 "l" 8572 "l" 8467 "l" 119845 "l" 119897 "l" 119949 "l" 120001 "l" 120053 "l" 120105 "l" 120157 "l" 120209 "l" 120261 "l" 120313 "l" 120365 "l" 120417 "l" 120469 "l" 448 "l" 921 "l" 120496 "l" 120554 "l" 120612 "l" 120670 "l" 120728 "l" 11410 "l" 1030 "l" 1231 "l" 1216 "l" 1493 "l" 1503 "l" 1575 "l" 126464 "l" 126592 "l" 65166 "l" 65165 "l" 1994 "l" 11599 "l" 5825 "l" 42226 "l" 93992 "l" 66186 "l" 66313 "l" 73178 "l" 73185 "l" 93866 "l" 119338 "L" 8556 "L" 8466 "L" 117985 "L" 119819 "L" 119871 "L" 119923 "L" 120027 "L" 120079 "L" 120131 "L" 120183 "L" 120235 "L" 120287 "L" 120339 "L" 120391 "L" 120443 "L" 11472 "L" 5086 "L" 5290 "L" 42209 "L" 93974 "L" 71843 "L" 71858 "L" 66587 "L" 66854 "L" 64828 "l̋" 64829 "l̋" 322 "l̸" 321 "L̸" 621 "l̨" 407 "l̵" 410 "l̵" 619 "l̴" 1573 "lٕ" 65160 "lٕ" 65159 "lٕ" 1651 "lٕ" 320 "l·" 319 "l·" 5303 "l·" 127234 "l," 9352 "l." 1521 "l'" 9363 "l2." 13291 "l2日" 13003 "l2月" 13156 "l2点" 9364 "l3." 13292 "l3日" 13157 "l3点" 9365 "l4." 13293 "l4日" 13158 "l4点" 9366 "l5." 13294 "l5日" 13159 "l5点" 9367 "l6." 13295 "l6日" 13160 "l6点" 9368 "l7." 13296 "l7日" 13161 "l7点" 9369 "l8." 13297 "l8日" 13162 "l8点" 9370 "l9." 13298 "l9日" 13163 "l9点" 457 "lj" 306 "lJ" 456 "Lj" 455 "LJ" 8214 "ll" 8741 "ll" 8545 "ll" 449 "ll" 1520 "ll" 65945 "l̵l̵" 9362 "ll." 8546 "lll" 65944 "l̵l̵S̵" 13290 "ll日" 13002 "ll月" 13155 "ll点" 1070 "lO" 9361 "lO." 13289 "lO日" 13001 "lO月" 13154 "lO点" 682 "ls" 8374 "lt" 8547 "lV" 8552 "lX" 622 "lȝ" 683 "lz" 1653 "lٴ" 1571 "lٴ" 65156 "lٴ" 65155 "lٴ" 1650 "lٴ" 65011 "lكبر" 65010 "lللّٰo" 13280 "l日" 12992 "l月" 13145 "l点" 11473 "ʟ" 43950 "ʟ" 66627 "ʟ" 65325 "M" 8559 "M" 8499 "M" 117986 "M" 119820 "M" 119872 "M" 119924 "M" 120028 "M" 120080 "M" 120132 "M" 120184 "M" 120236 "M" 120288 "M" 120340 "M" 120392 "M" 120444 "M" 924 "M" 120499 "M" 120557 "M" 120615 "M" 120673 "M" 120731 "M" 1018 "M" 11416 "M" 1052 "M" 5047 "M" 5616 "M" 5846 "M" 42207 "M" 66224 "M" 66321 "M" 1229 "M̦" 128875 "MB" 11752 "ᷟ" 119847 "n" 119899 "n" 119951 "n" 120003 "n" 120055 "n" 120107 "n" 120159 "n" 120211 "n" 120263 "n" 120315 "n" 120367 "n" 120419 "n" 120471 "n" 1400 "n" 1404 "n" 65326 "N" 8469 "N" 117987 "N" 119821 "N" 119873 "N" 119925 "N" 119977 "N" 120029 "N" 120081 "N" 120185 "N" 120237 "N" 120289 "N" 120341 "N" 120393 "N" 120445 "N" 925 "N" 120500 "N" 120558 "N" 120616 "N" 120674 "N" 120732 "N" 11418 "N" 42208 "N" 66835 "N" 65934 "N̊" 627 "n̨" 414 "n̩" 331 "n̩" 951 "n̩" 120520 "n̩" 120578 "n̩" 120636 "n̩" 120694 "n̩" 120752 "n̩" 1394 "n̩" 413 "N̦" 7536 "n̴" 460 "nj" 459 "Nj" 458 "NJ" 8470 "No" 11419 "ɴ" 887 "ᴎ" 1080 "ᴎ" 66637 "ᴎ" 326 "ɲ" 3074 "o" 3202 "o" 3330 "o" 3458 "o" 2406 "o" 2534 "o" 2662 "o" 2790 "o" 2918 "o" 3046 "o" 3174 "o" 3430 "o" 3664 "o" 3792 "o" 4160 "o" 6112 "o" 70864 "o" 1637 "o" 1781 "o" 65359 "o" 8500 "o" 119848 "o" 119900 "o" 119952 "o" 120056 "o" 120108 "o" 120160 "o" 120212 "o" 120264 "o" 120316 "o" 120368 "o" 120420 "o" 120472 "o" 7439 "o" 7441 "o" 43837 "o" 959 "o" 120528 "o" 120586 "o" 120644 "o" 120702 "o" 120760 "o" 963 "o" 120532 "o" 120590 "o" 120648 "o" 120706 "o" 120764 "o" 11423 "o" 1005 "o" 1086 "o" 4351 "o" 1413 "o" 1505 "o" 1607 "o" 126500 "o" 126564 "o" 126596 "o" 65259 "o" 65260 "o" 65258 "o" 65257 "o" 1726 "o" 64428 "o" 64429 "o" 64427 "o" 64426 "o" 1729 "o" 64424 "o" 64425 "o" 64423 "o" 64422 "o" 1749 "o" 3360 "o" 4125 "o" 66794 "o" 71880 "o" 71895 "o" 66604 "o" 48 "O" 1984 "O" 3302 "O" 12295 "O" 71904 "O" 118000 "O" 120782 "O" 120792 "O" 120802 "O" 120812 "O" 120822 "O" 130032 "O" 65327 "O" 117988 "O" 119822 "O" 119874 "O" 119926 "O" 119978 "O" 120030 "O" 120082 "O" 120134 "O" 120186 "O" 120238 "O" 120290 "O" 120342 "O" 120394 "O" 120446 "O" 927 "O" 120502 "O" 120560 "O" 120618 "O" 120676 "O" 120734 "O" 11422 "O" 1054 "O" 1365 "O" 11604 "O" 4816 "O" 2848 "O" 66754 "O" 42227 "O" 71861 "O" 66194 "O" 66219 "O" 66564 "O" 66838 "O" 73184 "O" 8304 "º" 7506 "º" 466 "ŏ" 465 "Ŏ" 1791 "ô" 336 "Ö" 248 "o̸" 43838 "o̸" 216 "O̸" 11585 "O̸" 510 "Ó̸" 629 "o̵" 42827 "o̵" 11409 "o̵" 1257 "o̵" 1139 "o̵" 43918 "o̵" 43963 "o̵" 8854 "O̵" 8861 "O̵" 9068 "O̵" 119322 "O̵" 128788 "O̵" 415 "O̵" 42826 "O̵" 952 "O̵" 977 "O̵" 120521 "O̵" 120541 "O̵" 120579 "O̵" 120599 "O̵" 120637 "O̵" 120657 "O̵" 120695 "O̵" 120715 "O̵" 120753 "O̵" 120773 "O̵" 920 "O̵" 1012 "O̵" 120495 "O̵" 120505 "O̵" 120553 "O̵" 120563 "O̵" 120611 "O̵" 120621 "O̵" 120669 "O̵" 120679 "O̵" 120727 "O̵" 120737 "O̵" 11408 "O̵" 1256 "O̵" 1138 "O̵" 11569 "O̵" 5054 "O̵" 5099 "O̵" 43892 "ơ" 64729 "oٰ" 127233 "O," 127232 "O." 417 "o'" 416 "O'" 5028 "O'" 37 "º/₀" 1642 "º/₀" 8274 "º/₀" 8240 "º/₀₀" 1545 "º/₀₀" 8241 "º/₀₀₀" 1546 "º/₀₀₀" 339 "oe" 338 "OE" 630 "oᴇ" 8734 "oo" 42831 "oo" 42649 "oo" 42830 "OO" 42648 "OO" 64727 "oج" 64593 "oج" 64728 "oم" 64594 "oم" 64915 "oمج" 64916 "oمم" 64595 "oى" 64596 "oى" 3423 "oരo" 4311 "oာ" 4112 "oာ" 13144 "O点" 8580 "ɔ" 7440 "ɔ" 891 "ɔ" 66635 "ɔ" 8579 "Ɔ" 1021 "Ɔ" 42203 "Ɔ" 66595 "Ɔ" 43839 "ɔ̸" 43874 "ɔe" 66623 "ɷ" 9076 "p" 65360 "p" 119849 "p" 119901 "p" 119953 "p" 120005 "p" 120057 "p" 120109 "p" 120161 "p" 120213 "p" 120265 "p" 120317 "p" 120369 "p" 120421 "p" 120473 "p" 254 "p" 447 "p" 961 "p" 1009 "p" 120530 "p" 120544 "p" 120588 "p" 120602 "p" 120646 "p" 120660 "p" 120704 "p" 120718 "p" 120762 "p" 120776 "p" 1016 "p" 11427 "p" 11471 "p" 1088 "p" 65328 "P" 8473 "P" 117989 "P" 119823 "P" 119875 "P" 119927 "P" 119979 "P" 120031 "P" 120083 "P" 120187 "P" 120239 "P" 120291 "P" 120343 "P" 120395 "P" 120447 "P" 929 "P" 120504 "P" 120562 "P" 120620 "P" 120678 "P" 120736 "P" 11426 "P" 11470 "P" 1056 "P" 5090 "P" 5229 "P" 42193 "P" 66197 "P" 421 "p̔" 7549 "p̵" 5239 "p·" 5254 "P'" 7465 "ᴘ" 43954 "ᴘ" 966 "ɸ" 981 "ɸ" 120535 "ɸ" 120543 "ɸ" 120593 "ɸ" 120601 "ɸ" 120651 "ɸ" 120659 "ɸ" 120709 "ɸ" 120717 "ɸ" 120767 "ɸ" 120775 "ɸ" 11435 "ɸ" 11489 "ɸ" 11488 "ɸ" 1092 "ɸ" 119850 "q" 119902 "q" 119954 "q" 120006 "q" 120058 "q" 120110 "q" 120162 "q" 120214 "q" 120266 "q" 120318 "q" 120370 "q" 120422 "q" 120474 "q" 1307 "q" 1379 "q" 1382 "q" 8474 "Q" 117990 "Q" 119824 "Q" 119876 "Q" 119928 "Q" 119980 "Q" 120032 "Q" 120084 "Q" 120188 "Q" 120240 "Q" 120292 "Q" 120344 "Q" 120396 "Q" 120448 "Q" 11605 "Q" 672 "q̔" 128768 "QE" 7568 "ɋ" 7435 "ĸ" 954 "ĸ" 1008 "ĸ" 120523 "ĸ" 120542 "ĸ" 120581 "ĸ" 120600 "ĸ" 120639 "ĸ" 120658 "ĸ" 120697 "ĸ" 120716 "ĸ" 120755 "ĸ" 120774 "ĸ" 11413 "ĸ" 1082 "ĸ" 43958 "ĸ" 1179 "ĸ̩" 1183 "ĸ̵" 119851 "r" 119903 "r" 119955 "r" 120007 "r" 120059 "r" 120111 "r" 120163 "r" 120215 "r" 120267 "r" 120319 "r" 120371 "r" 120423 "r" 120475 "r" 43847 "r" 43848 "r" 7462 "r" 11397 "r" 1075 "r" 43905 "r" 119318 "R" 8475 "R" 8476 "R" 8477 "R" 117991 "R" 119825 "R" 119877 "R" 119929 "R" 120033 "R" 120189 "R" 120241 "R" 120293 "R" 120345 "R" 120397 "R" 120449 "R" 422 "R" 5025 "R" 5074 "R" 66740 "R" 5511 "R" 42211 "R" 94005 "R" 637 "r̨" 636 "r̩" 589 "r̵" 1171 "r̵" 7538 "r̴" 1169 "r'" 71907 "rn" 109 "rn" 8575 "rn" 119846 "rn" 119898 "rn" 119950 "rn" 120002 "rn" 120054 "rn" 120106 "rn" 120158 "rn" 120210 "rn" 120262 "rn" 120314 "rn" 120366 "rn" 120418 "rn" 120470 "rn" 71424 "rn" 8357 "rn̸" 625 "rn̦" 7535 "rn̴" 8360 "Rs" 43889 "ʀ" 43938 "ʀ" 1103 "ᴙ" 7539 "ɾ̴" 8489 "ɿ" 65363 "s" 119852 "s" 119904 "s" 119956 "s" 120008 "s" 120060 "s" 120112 "s" 120164 "s" 120216 "s" 120268 "s" 120320 "s" 120372 "s" 120424 "s" 120476 "s" 42801 "s" 445 "s" 1109 "s" 3359 "s" 43946 "s" 71873 "s" 66632 "s" 65331 "S" 117992 "S" 119826 "S" 119878 "S" 119930 "S" 119982 "S" 120034 "S" 120086 "S" 120138 "S" 120190 "S" 120242 "S" 120294 "S" 120346 "S" 120398 "S" 120450 "S" 1029 "S" 1359 "S" 5077 "S" 5082 "S" 42210 "S" 94010 "S" 66198 "S" 66592 "S" 642 "s̨" 7540 "s̴" 42933 "ß" 7838 "ß" 42966 "ß" 946 "ß" 976 "ß" 120515 "ß" 120573 "ß" 120631 "ß" 120689 "ß" 120747 "ß" 5104 "ß" 128860 "sss" 64262 "st" 8747 "ʃ" 43853 "ʃ" 8721 "Ʃ" 8512 "Ʃ" 931 "Ʃ" 120506 "Ʃ" 120564 "Ʃ" 120622 "Ʃ" 120680 "Ʃ" 120738 "Ʃ" 11593 "Ʃ" 8748 "ʃʃ" 8749 "ʃʃʃ" 10764 "ʃʃʃʃ" 119853 "t" 119905 "t" 119957 "t" 120009 "t" 120061 "t" 120113 "t" 120165 "t" 120217 "t" 120269 "t" 120321 "t" 120373 "t" 120425 "t" 120477 "t" 8868 "T" 10201 "T" 128872 "T" 65332 "T" 117993 "T" 119827 "T" 119879 "T" 119931 "T" 119983 "T" 120035 "T" 120087 "T" 120139 "T" 120191 "T" 120243 "T" 120295 "T" 120347 "T" 120399 "T" 120451 "T" 932 "T" 120507 "T" 120565 "T" 120623 "T" 120681 "T" 120739 "T" 11430 "T" 1058 "T" 5026 "T" 42196 "T" 93962 "T" 71868 "T" 66199 "T" 66225 "T" 66325 "T" 429 "t̔" 9057 "T̈" 574 "T̸" 538 "Ţ" 430 "T̨" 1196 "T̩" 8366 "T⃫" 359 "t̵" 358 "T̵" 7541 "t̴" 4256 "Ꞇ" 42792 "T3" 680 "tɕ" 8481 "TEL" 42871 "tf" 678 "ts" 679 "tʃ" 42793 "tȝ" 964 "ᴛ" 120533 "ᴛ" 120591 "ᴛ" 120649 "ᴛ" 120707 "ᴛ" 120765 "ᴛ" 11431 "ᴛ" 1090 "ᴛ" 43890 "ᴛ" 1197 "ᴛ̩" 355 "ƫ" 539 "ƫ" 5055 "ƫ" 119854 "u" 119906 "u" 119958 "u" 120010 "u" 120062 "u" 120114 "u" 120166 "u" 120218 "u" 120270 "u" 120322 "u" 120374 "u" 120426 "u" 120478 "u" 42911 "u" 7452 "u" 43854 "u" 43858 "u" 651 "u" 965 "u" 120534 "u" 120592 "u" 120650 "u" 120708 "u" 120766 "u" 1405 "u" 66806 "u" 71896 "u" 8746 "U" 8899 "U" 117994 "U" 119828 "U" 119880 "U" 119932 "U" 119984 "U" 120036 "U" 120088 "U" 120140 "U" 120192 "U" 120244 "U" 120296 "U" 120348 "U" 120400 "U" 120452 "U" 1357 "U" 4608 "U" 66766 "U" 5196 "U" 42228 "U" 94018 "U" 71864 "U" 468 "ŭ" 467 "Ŭ" 1119 "u̩" 7550 "u̵" 43932 "u̵" 580 "U̵" 5068 "U̵" 5208 "U·" 5223 "U'" 7531 "ue" 43875 "uo" 7747 "ꭑ" 1402 "ɰ" 4643 "ɰ" 8487 "Ʊ" 5678 "Ʊ" 5684 "Ʊ" 7551 "ʊ̵" 8744 "v" 8897 "v" 65366 "v" 8564 "v" 119855 "v" 119907 "v" 119959 "v" 120011 "v" 120063 "v" 120115 "v" 120167 "v" 120219 "v" 120271 "v" 120323 "v" 120375 "v" 120427 "v" 120479 "v" 7456 "v" 957 "v" 120526 "v" 120584 "v" 120642 "v" 120700 "v" 120758 "v" 1141 "v" 1496 "v" 71430 "v" 43945 "v" 71872 "v" 119309 "V" 1639 "V" 1783 "V" 8548 "V" 117995 "V" 119829 "V" 119881 "V" 119933 "V" 119985 "V" 120037 "V" 120089 "V" 120141 "V" 120193 "V" 120245 "V" 120297 "V" 120349 "V" 120401 "V" 120453 "V" 1140 "V" 11576 "V" 5081 "V" 5167 "V" 42719 "V" 42214 "V" 93960 "V" 71840 "V" 66845 "V" 65943 "V̵" 5179 "V·" 128876 "VB" 8565 "vi" 8566 "vii" 8567 "viii" 8549 "Vl" 8550 "Vll" 8551 "Vlll" 128776 "Vᷤ" 7463 "ʌ" 11415 "ʌ" 66776 "ʌ" 1640 "Ʌ" 1784 "Ʌ" 42970 "Ʌ" 923 "Ʌ" 120498 "Ʌ" 120556 "Ʌ" 120614 "Ʌ" 120672 "Ʌ" 120730 "Ʌ" 1051 "Ʌ" 11575 "Ʌ" 66736 "Ʌ" 5169 "Ʌ" 42702 "Ʌ" 42213 "Ʌ" 94013 "Ʌ" 66189 "Ʌ" 42972 "Ʌ̸" 1221 "Ʌ̦" 5181 "Ʌ·" 623 "w" 119856 "w" 119908 "w" 119960 "w" 120012 "w" 120064 "w" 120116 "w" 120168 "w" 120220 "w" 120272 "w" 120324 "w" 120376 "w" 120428 "w" 120480 "w" 7457 "w" 11453 "w" 1121 "w" 1096 "w" 1309 "w" 1377 "w" 71434 "w" 71438 "w" 71439 "w" 43907 "w" 71910 "W" 71919 "W" 117996 "W" 119830 "W" 119882 "W" 119934 "W" 119986 "W" 120038 "W" 120090 "W" 120142 "W" 120194 "W" 120246 "W" 120298 "W" 120350 "W" 120402 "W" 120454 "W" 1308 "W" 5043 "W" 5076 "W" 42218 "W" 1149 "w҆҇" 70853 "ẇ" 8361 "W̵" 42849 "w̦" 7437 "ʍ" 11417 "ʍ" 1084 "ʍ" 43911 "ʍ" 1230 "ʍ̦" 5742 "x" 215 "x" 10539 "x" 10540 "x" 10799 "x" 65368 "x" 8569 "x" 119857 "x" 119909 "x" 119961 "x" 120013 "x" 120065 "x" 120117 "x" 120169 "x" 120221 "x" 120273 "x" 120325 "x" 120377 "x" 120429 "x" 120481 "x" 1093 "x" 5441 "x" 5501 "x" 11759 "ͯ" 5741 "X" 9587 "X" 66338 "X" 71916 "X" 65336 "X" 8553 "X" 117997 "X" 119831 "X" 119883 "X" 119935 "X" 119987 "X" 120039 "X" 120091 "X" 120143 "X" 120195 "X" 120247 "X" 120299 "X" 120351 "X" 120403 "X" 120455 "X" 42931 "X" 935 "X" 120510 "X" 120568 "X" 120626 "X" 120684 "X" 120742 "X" 11436 "X" 1061 "X" 11613 "X" 5815 "X" 42219 "X" 66192 "X" 66228 "X" 66327 "X" 66855 "X" 10800 "ẋ" 1202 "X̩" 65942 "X̵" 8570 "xi" 8571 "xii" 8554 "Xl" 8555 "Xll" 611 "y" 7564 "y" 65369 "y" 119858 "y" 119910 "y" 119962 "y" 120014 "y" 120066 "y" 120118 "y" 120170 "y" 120222 "y" 120274 "y" 120326 "y" 120378 "y" 120430 "y" 120482 "y" 655 "y" 7935 "y" 43866 "y" 947 "y" 8509 "y" 120516 "y" 120574 "y" 120632 "y" 120690 "y" 120748 "y" 11433 "y" 1091 "y" 1199 "y" 4327 "y" 71900 "y" 65337 "Y" 117998 "Y" 119832 "Y" 119884 "Y" 119936 "Y" 119988 "Y" 120040 "Y" 120092 "Y" 120144 "Y" 120196 "Y" 120248 "Y" 120300 "Y" 120352 "Y" 120404 "Y" 120456 "Y" 933 "Y" 978 "Y" 120508 "Y" 120566 "Y" 120624 "Y" 120682 "Y" 120740 "Y" 11432 "Y" 1059 "Y" 1198 "Y" 5033 "Y" 5053 "Y" 42220 "Y" 94019 "Y" 71844 "Y" 66226 "Y" 436 "y̔" 591 "y̵" 1201 "y̵" 165 "Y̵" 590 "Y̵" 1200 "Y̵" 658 "ȝ" 42859 "ȝ" 11461 "ȝ" 11469 "ȝ" 1249 "ȝ" 4339 "ȝ" 119859 "z" 119911 "z" 119963 "z" 120015 "z" 120067 "z" 120119 "z" 120171 "z" 120223 "z" 120275 "z" 120327 "z" 120379 "z" 120431 "z" 120483 "z" 7458 "z" 43923 "z" 71876 "z" 71909 "Z" 66293 "Z" 65338 "Z" 8484 "Z" 8488 "Z" 117999 "Z" 119833 "Z" 119885 "Z" 119937 "Z" 119989 "Z" 120041 "Z" 120197 "Z" 120249 "Z" 120301 "Z" 120353 "Z" 120405 "Z" 120457 "Z" 918 "Z" 120493 "Z" 120551 "Z" 120609 "Z" 120667 "Z" 120725 "Z" 5059 "Z" 42204 "Z" 71849 "Z" 656 "z̨" 438 "z̵" 437 "Z̵" 549 "z̦" 548 "Z̦" 7542 "z̴" 11405 "ⱬ" 11404 "Ⱬ" 11421 "ʓ" 1015 "Þ" 66756 "Þ" 42962 "ꟓ" 42964 "ꟕ" 8313 "ꝰ" 7460 "ƨ" 1001 "ƨ" 42565 "ƨ" 1100 "ƅ" 43935 "ƅ" 93905 "ƅ" 1099 "ƅi" 43902 "ɂ" 740 "ˁ" 42701 "ʡ" 9578 "ǂ" 8857 "ʘ" 9737 "ʘ" 10752 "ʘ" 42600 "ʘ" 11609 "ʘ" 66755 "ʘ" 8510 "Γ" 120490 "Γ" 120548 "Γ" 120606 "Γ" 120664 "Γ" 120722 "Γ" 11396 "Γ" 1043 "Γ" 5041 "Γ" 5285 "Γ" 93959 "Γ" 1170 "Γ̵" 5295 "Γ·" 1168 "Γ'" 8710 "Δ" 9651 "Δ" 128770 "Δ" 120491 "Δ" 120549 "Δ" 120607 "Δ" 120665 "Δ" 120723 "Δ" 11398 "Δ" 11616 "Δ" 5123 "Δ" 93978 "Δ" 66181 "Δ" 66211 "Δ" 9049 "Δ̲" 5135 "Δ·" 5164 "Δᐠ" 120779 "ϝ" 120519 "ζ" 120577 "ζ" 120635 "ζ" 120693 "ζ" 120751 "ζ" 11492 "ϗ" 42971 "λ" 120524 "λ" 120582 "λ" 120640 "λ" 120698 "λ" 120756 "λ" 11414 "λ" 66779 "λ" 411 "λ̸" 181 "μ" 120525 "μ" 120583 "μ" 120641 "μ" 120699 "μ" 120757 "μ" 120527 "ξ" 120585 "ξ" 120643 "ξ" 120701 "ξ" 120759 "ξ" 9776 "Ξ" 120501 "Ξ" 120559 "Ξ" 120617 "Ξ" 120675 "Ξ" 120733 "Ξ" 11446 "Ξ" 982 "π" 8508 "π" 120529 "π" 120545 "π" 120587 "π" 120603 "π" 120645 "π" 120661 "π" 120703 "π" 120719 "π" 120761 "π" 120777 "π" 7464 "π" 11425 "π" 1087 "π" 93889 "π" 8719 "Π" 8511 "Π" 120503 "Π" 120561 "Π" 120619 "Π" 120677 "Π" 120735 "Π" 11424 "Π" 1055 "Π" 42715 "Π" 93862 "Π" 66221 "Ϙ" 66322 "Ϙ" 11457 "ϼ" 987 "ς" 120531 "ς" 120589 "ς" 120647 "ς" 120705 "ς" 120763 "ς" 11403 "ς" 120509 "Φ" 120567 "Φ" 120625 "Φ" 120683 "Φ" 120741 "Φ" 11434 "Φ" 1060 "Φ" 1363 "Φ" 4672 "Φ" 5872 "Φ" 66227 "Φ" 43859 "χ" 43861 "χ" 120536 "χ" 120594 "χ" 120652 "χ" 120710 "χ" 120768 "χ" 11437 "χ" 120537 "ψ" 120595 "ψ" 120653 "ψ" 120711 "ψ" 120769 "ψ" 11439 "ψ" 1137 "ψ" 66809 "ψ" 120511 "Ψ" 120569 "Ψ" 120627 "Ψ" 120685 "Ψ" 120743 "Ψ" 11438 "Ψ" 1136 "Ψ" 66769 "Ψ" 5848 "Ψ" 66229 "Ψ" 9077 "ω" 42935 "ω" 120538 "ω" 120596 "ω" 120654 "ω" 120712 "ω" 120770 "ω" 11441 "ω" 42573 "ω" 8486 "Ω" 120512 "Ω" 120570 "Ω" 120628 "Ω" 120686 "Ω" 120744 "Ω" 5679 "Ω" 5685 "Ω" 66230 "Ω" 9081 "ω̲" 8061 "ῴ" 1175 "ж̩" 1174 "Ж̩" 119307 "И" 886 "И" 42657 "И" 66597 "И" 1049 "Ѝ" 1162 "Ѝ̦" 1117 "й" 1163 "й̦" 66748 "Ӄ" 7467 "л" 1222 "л̦" 43872 "љ" 66795 "ꙩ" 7662 "ⷬ" 66765 "Ћ" 119298 "Ӿ" 119330 "Ѡ" 5063 "Ѡ" 5615 "Ѡ" 1148 "Ѡ҆҇" 6381 "Ѡ·" 42934 "Ꙍ" 11440 "Ꙍ" 2795 "ч" 997 "ч" 2730 "ч" 996 "Ч" 1228 "ҷ" 1227 "Ҷ" 1214 "Ҽ̨" 11452 "Ш" 42576 "Ъl" 8456 "Э" 128769 "Ꙙ" 93980 "Ꙙ" 43410 "ⰿ" 1415 "եi" 4756 "ձ" 64276 "մե" 64277 "մի" 64279 "մխ" 64275 "մն" 8745 "Ո" 8898 "Ո" 119365 "Ո" 4704 "Ո" 5198 "Ո" 42229 "Ո" 5210 "Ո·" 5224 "Ո'" 64278 "վն" 11496 "Ք" 65952 "Ք" 8381 "Ք" 11456 "Ք" 723 "ՙ" 703 "ՙ" 8501 "א" 64289 "א" 64303 "אַ" 64304 "אַ" 64335 "אל" 8502 "ב" 8503 "ג" 8504 "ד" 64290 "ד" 64291 "ה" 64313 "יִ" 64292 "כ" 64293 "ל" 64294 "ם" 64288 "ע" 64295 "ר" 64299 "שׁ" 64329 "שׁ" 64301 "שּׁ" 64296 "ת" 65152 "ء" 1789 "ء𐻺" 65154 "آ" 65153 "آ" 64337 "ٱ" 64336 "ٱ" 126465 "ب" 126497 "ب" 126561 "ب" 126593 "ب" 126625 "ب" 65169 "ب" 65170 "ب" 65168 "ب" 65167 "ب" 1873 "بۛ" 2230 "بۢ" 2209 "بٔ" 64672 "بo" 64738 "بo" 64668 "بج" 64517 "بج" 64669 "بح" 64518 "بح" 64962 "بحى" 64670 "بخ" 64519 "بخ" 64722 "بخ" 64587 "بخ" 64926 "بخى" 64618 "بر" 64619 "بز" 64671 "بم" 64737 "بم" 64620 "بم" 64520 "بم" 64621 "بن" 64622 "بى" 64521 "بى" 64623 "بى" 64522 "بى" 64340 "ٻ" 64341 "ٻ" 64339 "ٻ" 64338 "ٻ" 1744 "ٻ" 64486 "ٻ" 64487 "ٻ" 64485 "ٻ" 64484 "ٻ" 64348 "ڀ" 64349 "ڀ" 64347 "ڀ" 64346 "ڀ" 69319 "ڀ" 2217 "ݔ" 1895 "ݔ" 9061 "ة" 246 "ة" 65172 "ة" 65171 "ة" 1731 "ة" 126485 "ت" 126517 "ت" 126581 "ت" 126613 "ت" 126645 "ت" 65175 "ت" 65176 "ت" 65174 "ت" 65173 "ت" 1658 "ت" 64352 "ت" 64353 "ت" 64351 "ت" 64350 "ت" 2239 "ت̆" 64677 "تo" 64740 "تo" 64673 "تج" 64523 "تج" 64848 "تجم" 64928 "تجى" 64927 "تجى" 64674 "تح" 64524 "تح" 64850 "تحج" 64849 "تحج" 64851 "تحم" 64675 "تخ" 64525 "تخ" 64852 "تخم" 64930 "تخى" 64929 "تخى" 64624 "تر" 64625 "تز" 64676 "تم" 64739 "تم" 64626 "تم" 64526 "تم" 64853 "تمج" 64854 "تمح" 64855 "تمخ" 64932 "تمى" 64931 "تمى" 64627 "تن" 64628 "تى" 64527 "تى" 64629 "تى" 64528 "تى" 64356 "ٿ" 64357 "ٿ" 64355 "ٿ" 64354 "ٿ" 126466 "ج" 126498 "ج" 126530 "ج" 126562 "ج" 126594 "ج" 126626 "ج" 65183 "ج" 65184 "ج" 65182 "ج" 65181 "ج" 64679 "جح" 64533 "جح" 64934 "جحى" 64958 "جحى" 65019 "جل جلlلo" 64680 "جم" 64534 "جم" 64857 "جمح" 64856 "جمح" 64935 "جمى" 64933 "جمى" 64797 "جى" 64769 "جى" 64798 "جى" 64770 "جى" 64376 "ڃ" 64377 "ڃ" 64375 "ڃ" 64374 "ڃ" 64372 "ڄ" 64373 "ڄ" 64371 "ڄ" 64370 "ڄ" 64380 "چ" 64381 "چ" 64379 "چ" 64378 "چ" 2241 "چ̆" 64384 "ڇ" 64385 "ڇ" 64383 "ڇ" 64382 "ڇ" 126471 "ح" 126503 "ح" 126535 "ح" 126567 "ح" 126599 "ح" 126631 "ح" 65187 "ح" 65188 "ح" 65186 "ح" 65185 "ح" 1669 "حۛ" 1665 "حٔ" 1906 "حٔ" 64681 "حج" 64535 "حج" 64959 "حجى" 64682 "حم" 64536 "حم" 64859 "حمى" 64858 "حمى" 64795 "حى" 64767 "حى" 64796 "حى" 64768 "حى" 126487 "خ" 126519 "خ" 126551 "خ" 126583 "خ" 126615 "خ" 126647 "خ" 65191 "خ" 65192 "خ" 65190 "خ" 65189 "خ" 64683 "خج" 64537 "خج" 64538 "خح" 64684 "خم" 64539 "خم" 64799 "خى" 64771 "خى" 64800 "خى" 64772 "خى" 66273 "د" 126467 "د" 126595 "د" 126627 "د" 65194 "د" 65193 "د" 1672 "دؕ" 64393 "دؕ" 64392 "دؕ" 1678 "دۛ" 64391 "دۛ" 64390 "دۛ" 1679 "دۛ" 1774 "د̂" 2222 "د̤̣" 126488 "ذ" 126616 "ذ" 126648 "ذ" 65196 "ذ" 65195 "ذ" 64603 "ذٰ" 1675 "ڊؕ" 64389 "ڌ" 64388 "ڌ" 64387 "ڍ" 64386 "ڍ" 126483 "ر" 126611 "ر" 126643 "ر" 65198 "ر" 65197 "ر" 1681 "رؕ" 64397 "رؕ" 64396 "رؕ" 1688 "رۛ" 64395 "رۛ" 64394 "رۛ" 1682 "ر̆" 2233 "ر̆̇" 1775 "ر̂" 1900 "رٔ" 64604 "رٰ" 65014 "رسول" 65020 "رىlل" 8385 "رىlل" 126470 "ز" 126598 "ز" 126630 "ز" 65200 "ز" 65199 "ز" 2226 "ز̂" 1905 "ڗؕ" 126478 "س" 126510 "س" 126542 "س" 126574 "س" 126606 "س" 126638 "س" 65203 "س" 65204 "س" 65202 "س" 65201 "س" 1588 "سۛ" 126484 "سۛ" 126516 "سۛ" 126548 "سۛ" 126580 "سۛ" 126612 "سۛ" 126644 "سۛ" 65207 "سۛ" 65208 "سۛ" 65206 "سۛ" 65205 "سۛ" 1918 "س̂" 64817 "سo" 64744 "سo" 64818 "سۛo" 64746 "سۛo" 64685 "سج" 64820 "سج" 64540 "سج" 64813 "سۛج" 64823 "سۛج" 64805 "سۛج" 64777 "سۛج" 64861 "سجح" 64862 "سجى" 64873 "سۛجى" 64686 "سح" 64821 "سح" 64541 "سح" 64814 "سۛح" 64824 "سۛح" 64806 "سۛح" 64778 "سۛح" 64860 "سحج" 64872 "سۛحم" 64871 "سۛحم" 64938 "سۛحى" 64687 "سخ" 64822 "سخ" 64542 "سخ" 64815 "سۛخ" 64825 "سۛخ" 64807 "سۛخ" 64779 "سۛخ" 64936 "سخى" 64966 "سخى" 64810 "سر" 64782 "سر" 64809 "سۛر" 64781 "سۛر" 64688 "سم" 64743 "سم" 64543 "سم" 64816 "سۛم" 64745 "سۛم" 64808 "سۛم" 64780 "سۛم" 64865 "سمج" 64864 "سمح" 64863 "سمح" 64875 "سۛمخ" 64874 "سۛمخ" 64867 "سمم" 64866 "سمم" 64877 "سۛمم" 64876 "سۛمم" 64791 "سى" 64763 "سى" 64792 "سى" 64764 "سى" 64793 "سۛى" 64765 "سۛى" 64794 "سۛى" 64766 "سۛى" 66290 "ص" 126481 "ص" 126513 "ص" 126545 "ص" 126577 "ص" 126609 "ص" 126641 "ص" 65211 "ص" 65212 "ص" 65210 "ص" 65209 "ص" 1694 "صۛ" 2223 "ص̤̣" 64689 "صح" 64544 "صح" 64869 "صحح" 64868 "صحح" 64937 "صحى" 64690 "صخ" 64811 "صر" 64783 "صر" 65013 "صلعم" 65017 "صلى" 65008 "صلى" 65018 "صلى lللo علىo وسلم" 64691 "صم" 64545 "صم" 64965 "صمم" 64870 "صمم" 64801 "صى" 64773 "صى" 64802 "صى" 64774 "صى" 126489 "ض" 126521 "ض" 126553 "ض" 126585 "ض" 126617 "ض" 126649 "ض" 65215 "ض" 65216 "ض" 65214 "ض" 65213 "ض" 64692 "ضج" 64546 "ضج" 64693 "ضح" 64547 "ضح" 64878 "ضحى" 64939 "ضحى" 64694 "ضخ" 64548 "ضخ" 64880 "ضخم" 64879 "ضخم" 64812 "ضر" 64784 "ضر" 64695 "ضم" 64549 "ضم" 64803 "ضى" 64775 "ضى" 64804 "ضى" 64776 "ضى" 66280 "ط" 126472 "ط" 126568 "ط" 126600 "ط" 126632 "ط" 65219 "ط" 65220 "ط" 65218 "ط" 65217 "ط" 1695 "طۛ" 64696 "طح" 64550 "طح" 64819 "طم" 64826 "طم" 64551 "طم" 64882 "طمح" 64881 "طمح" 64883 "طمم" 64884 "طمى" 64785 "طى" 64757 "طى" 64786 "طى" 64758 "طى" 126490 "ظ" 126586 "ظ" 126618 "ظ" 126650 "ظ" 65223 "ظ" 65224 "ظ" 65222 "ظ" 65221 "ظ" 64697 "ظم" 64827 "ظم" 64552 "ظم" 1551 "ع" 126479 "ع" 126511 "ع" 126543 "ع" 126575 "ع" 126607 "ع" 126639 "ع" 65227 "ع" 65228 "ع" 65226 "ع" 65225 "ع" 64698 "عج" 64553 "عج" 64964 "عجم" 64885 "عجم" 65015 "علىo" 64699 "عم" 64554 "عم" 64887 "عمم" 64886 "عمم" 64888 "عمى" 64950 "عمى" 64787 "عى" 64759 "عى" 64788 "عى" 64760 "عى" 126491 "غ" 126523 "غ" 126555 "غ" 126587 "غ" 126619 "غ" 126651 "غ" 65231 "غ" 65232 "غ" 65230 "غ" 65229 "غ" 64700 "غج" 64555 "غج" 64701 "غم" 64556 "غم" 64889 "غمم" 64891 "غمى" 64890 "غمى" 64789 "غى" 64761 "غى" 64790 "غى" 64762 "غى" 126480 "ف" 126512 "ف" 126576 "ف" 126608 "ف" 126640 "ف" 65235 "ف" 65236 "ف" 65234 "ف" 65233 "ف" 1703 "ف" 64702 "فج" 64557 "فج" 64703 "فح" 64558 "فح" 64704 "فخ" 64559 "فخ" 64893 "فخم" 64892 "فخم" 64705 "فم" 64560 "فم" 64961 "فمى" 64636 "فى" 64561 "فى" 64637 "فى" 64562 "فى" 126494 "ڡ" 126590 "ڡ" 2235 "ڡ" 1647 "ڡ" 126495 "ڡ" 126559 "ڡ" 2236 "ڡ" 1700 "ڡۛ" 64364 "ڡۛ" 64365 "ڡۛ" 64363 "ڡۛ" 64362 "ڡۛ" 1704 "ڡۛ" 2212 "ڢۛ" 64368 "ڦ" 64369 "ڦ" 64367 "ڦ" 64366 "ڦ" 126482 "ق" 126514 "ق" 126546 "ق" 126578 "ق" 126610 "ق" 126642 "ق" 65239 "ق" 65240 "ق" 65238 "ق" 65237 "ق" 64706 "قح" 64563 "قح" 65009 "قلى" 64707 "قم" 64564 "قم" 64948 "قمح" 64894 "قمح" 64895 "قمم" 64946 "قمى" 64638 "قى" 64565 "قى" 64639 "قى" 64566 "قى" 126474 "ك" 126506 "ك" 126570 "ك" 65243 "ك" 65244 "ك" 65242 "ك" 65241 "ك" 1705 "ك" 64400 "ك" 64401 "ك" 64399 "ك" 64398 "ك" 1706 "ك" 1709 "كۛ" 64469 "كۛ" 64470 "كۛ" 64468 "كۛ" 64467 "كۛ" 1891 "كۛ" 2242 "ك̆" 64640 "كl" 64567 "كl" 64708 "كج" 64568 "كج" 64709 "كح" 64569 "كح" 64710 "كخ" 64570 "كخ" 64711 "كل" 64747 "كل" 64641 "كل" 64571 "كل" 64712 "كم" 64748 "كم" 64642 "كم" 64572 "كم" 64963 "كمم" 64955 "كمم" 64951 "كمى" 64643 "كى" 64573 "كى" 64644 "كى" 64574 "كى" 1890 "ڬ" 64404 "گ" 64405 "گ" 64403 "گ" 64402 "گ" 2224 "گ" 1716 "گۛ" 64412 "ڱ" 64413 "ڱ" 64411 "ڱ" 64410 "ڱ" 64408 "ڳ" 64409 "ڳ" 64407 "ڳ" 64406 "ڳ" 126475 "ل" 126507 "ل" 126539 "ل" 126603 "ل" 126635 "ل" 65247 "ل" 65248 "ل" 65246 "ل" 65245 "ل" 1719 "لۛ" 1717 "ل̆" 65276 "لl" 65275 "لl" 65274 "لlٕ" 65273 "لlٕ" 65272 "لlٴ" 65271 "لlٴ" 64717 "لo" 65270 "لآ" 65269 "لآ" 64713 "لج" 64575 "لج" 64899 "لجج" 64900 "لجج" 64954 "لجم" 64956 "لجم" 64940 "لجى" 64714 "لح" 64576 "لح" 64949 "لحم" 64896 "لحم" 64898 "لحى" 64897 "لحى" 64715 "لخ" 64577 "لخ" 64902 "لخم" 64901 "لخم" 64716 "لم" 64749 "لم" 64645 "لم" 64578 "لم" 64904 "لمح" 64903 "لمح" 64941 "لمى" 64646 "لى" 64579 "لى" 64647 "لى" 64580 "لى" 126476 "م" 126508 "م" 126572 "م" 126604 "م" 126636 "م" 65251 "م" 65252 "م" 65250 "م" 65249 "م" 2215 "مۛ" 64648 "مl" 64718 "مج" 64581 "مج" 64908 "مجح" 64914 "مجخ" 64909 "مجم" 64960 "مجى" 64719 "مح" 64582 "مح" 64905 "محج" 64906 "محم" 65012 "محمد" 64907 "محى" 64720 "مخ" 64583 "مخ" 64910 "مخج" 64911 "مخم" 64953 "مخى" 64721 "مم" 64649 "مم" 64584 "مم" 64945 "ممى" 64585 "مى" 64586 "مى" 1790 "م𐻺" 126477 "ن" 126509 "ن" 126541 "ن" 126573 "ن" 126605 "ن" 126637 "ن" 65255 "ن" 65256 "ن" 65254 "ن" 65253 "ن" 69318 "ن" 1896 "نؕ" 1897 "ن̆" 64726 "نo" 64751 "نo" 64952 "نجح" 64957 "نجح" 64920 "نجم" 64919 "نجم" 64921 "نجى" 64967 "نجى" 64723 "نح" 64588 "نح" 64917 "نحم" 64918 "نحى" 64947 "نحى" 64724 "نخ" 64589 "نخ" 64650 "نر" 64651 "نز" 64725 "نم" 64750 "نم" 64652 "نم" 64590 "نم" 64923 "نمى" 64922 "نمى" 64653 "نن" 64654 "نى" 64591 "نى" 64655 "نى" 64592 "نى" 1730 "ۀ" 64421 "ۀ" 64420 "ۀ" 66276 "و" 126469 "و" 126597 "و" 126629 "و" 65262 "و" 65261 "و" 2225 "و" 1739 "وۛ" 64479 "وۛ" 64478 "وۛ" 1735 "و̓" 64472 "و̓" 64471 "و̓" 1734 "و̆" 64474 "و̆" 64473 "و̆" 1737 "و̂" 64483 "و̂" 64482 "و̂" 1736 "وٰ" 64476 "وٰ" 64475 "وٰ" 1654 "وٴ" 1572 "وٴ" 65158 "وٴ" 65157 "وٴ" 1655 "و̓ٴ" 64477 "و̓ٴ" 65016 "وسلم" 64481 "ۅ" 64480 "ۅ" 1646 "ى" 126492 "ى" 126588 "ى" 1722 "ى" 126493 "ى" 126557 "ى" 64415 "ى" 64414 "ى" 2237 "ى" 64488 "ى" 64489 "ى" 65264 "ى" 65263 "ى" 1610 "ى" 126473 "ى" 126505 "ى" 126537 "ى" 126569 "ى" 126601 "ى" 126633 "ى" 65267 "ى" 65268 "ى" 65266 "ى" 65265 "ى" 1740 "ى" 64510 "ى" 64511 "ى" 64509 "ى" 64508 "ى" 1746 "ى" 64431 "ى" 64430 "ى" 1657 "ىؕ" 64360 "ىؕ" 64361 "ىؕ" 64359 "ىؕ" 64358 "ىؕ" 1723 "ىؕ" 64418 "ىؕ" 64419 "ىؕ" 64417 "ىؕ" 64416 "ىؕ" 1662 "ىۛ" 64344 "ىۛ" 64345 "ىۛ" 64343 "ىۛ" 64342 "ىۛ" 1874 "ىۛ" 1579 "ىۛ" 126486 "ىۛ" 126518 "ىۛ" 126582 "ىۛ" 126614 "ىۛ" 126646 "ىۛ" 65179 "ىۛ" 65180 "ىۛ" 65178 "ىۛ" 65177 "ىۛ" 1725 "ىۛ" 1745 "ىۛ" 1599 "ىۛ" 2231 "ىۛۢ" 1878 "ى̆" 1742 "ى̆" 2240 "ىؕ̆" 2238 "ىۛ̆" 2234 "ى̆̇" 1597 "ى̂" 2191 "ى̊" 2216 "ىٔ" 64656 "ىٰ" 64605 "ىٰ" 64734 "ىo" 64753 "ىo" 64742 "ىۛo" 1656 "ىٴ" 1574 "ىٴ" 65163 "ىٴ" 65164 "ىٴ" 65162 "ىٴ" 65161 "ىٴ" 64491 "ىٴl" 64490 "ىٴl" 64667 "ىٴo" 64736 "ىٴo" 64493 "ىٴo" 64492 "ىٴo" 64504 "ىٴٻ" 64503 "ىٴٻ" 64502 "ىٴٻ" 64663 "ىٴج" 64512 "ىٴج" 64664 "ىٴح" 64513 "ىٴح" 64665 "ىٴخ" 64612 "ىٴر" 64613 "ىٴز" 64666 "ىٴم" 64735 "ىٴم" 64614 "ىٴم" 64514 "ىٴم" 64615 "ىٴن" 64495 "ىٴو" 64494 "ىٴو" 64497 "ىٴو̓" 64496 "ىٴو̓" 64499 "ىٴو̆" 64498 "ىٴو̆" 64501 "ىٴوٰ" 64500 "ىٴوٰ" 64507 "ىٴى" 64506 "ىٴى" 64616 "ىٴى" 64505 "ىٴى" 64515 "ىٴى" 64617 "ىٴى" 64516 "ىٴى" 64730 "ىج" 64597 "ىج" 64529 "ىۛج" 64943 "ىجى" 64731 "ىح" 64598 "ىح" 64942 "ىحى" 64732 "ىخ" 64599 "ىخ" 64657 "ىر" 64630 "ىۛر" 64658 "ىز" 64631 "ىۛز" 64733 "ىم" 64752 "ىم" 64659 "ىم" 64600 "ىم" 64678 "ىۛم" 64741 "ىۛم" 64632 "ىۛم" 64530 "ىۛم" 64925 "ىمم" 64924 "ىمم" 64944 "ىمى" 64660 "ىن" 64633 "ىۛن" 64661 "ىى" 64601 "ىى" 64662 "ىى" 64602 "ىى" 64634 "ىۛى" 64531 "ىۛى" 64635 "ىۛى" 64532 "ىۛى" 64433 "ۓ" 64432 "ۓ" 66232 "ⵀ" 8286 "ⵂ" 11837 "ⵂ" 10649 "ⵂ" 118511 "ⵂ" 65049 "ⵗ" 8285 "ⵗ" 8942 "ⵗ" 1348 "ሆ" 1356 "ቡ" 1339 "ኮ" 1354 "ጣ" 2418 "अ̆" 2310 "अा" 2321 "अा̆" 2420 "अाऺ" 2322 "अाॆ" 2324 "अाै" 2323 "अा𑭤" 2419 "अऺ" 2421 "अॏ" 2308 "अॆ" 2596 "उ" 2317 "ए̆" 2318 "एॆ" 2320 "ए𑭤" 2591 "ट" 2592 "ठ" 2603 "ढ" 2588 "त्त" 2599 "प" 2674 "प्ट" 2567 "प्टি" 2568 "प्टੀ" 2575 "प्ट𑭤" 2606 "भ" 2616 "म" 2312 "र्इ" 2581 "व" 2613 "ह" 2749 "ऽ" 70108 "ꣻ" 2377 "ा̆" 2363 "ाऺ" 70091 "ऺ" 72544 "ऺ" 2753 "ु" 2754 "ू" 2635 "ॆ" 2632 "ै" 2637 "्" 2765 "्" 2438 "অা" 2528 "ঋৃ" 2529 "ঋৃ" 70802 "ঘ" 70804 "চ" 70806 "জ" 70808 "ঞ" 70809 "ট" 70811 "ড" 70826 "ণ" 70814 "ত" 70815 "থ" 70816 "দ" 70817 "ধ" 70818 "ন" 70819 "প" 70825 "ব" 70823 "ম" 70824 "য" 2544 "র" 70827 "র" 70813 "ল" 70829 "ষ" 70830 "স" 70852 "ঽ" 70832 "া" 2367 "ি" 2623 "ি" 70833 "ি" 70841 "ে" 70844 "ো" 70846 "ৌ" 70850 "্" 70845 "ৗ" 2569 "ੳ𑭢" 2570 "ੳ𑭣" 2576 "ਅै" 2566 "ਅਾ" 2580 "ਅੌ" 2694 "અા" 2705 "અાૅ" 2707 "અાે" 2708 "અાૈ" 2701 "અૅ" 2703 "અે" 2704 "અૈ" 2822 "ଅା" 4145 "େ" 3054 "அ" 2992 "ஈ" 3006 "ஈ" 3051 "ஈு" 3048 "உ" 3337 "உ" 2954 "உள" 3338 "உൗ" 3053 "எ" 3063 "எவ" 2972 "ஐ" 3356 "ஐ" 2964 "ஒள" 3047 "க" 3050 "ச" 3052 "சு" 3058 "சூ" 3386 "டி" 3363 "ண" 3450 "ண്" 3066 "நீ" 3365 "ம" 3060 "மீ" 3056 "ய" 3350 "வ" 3380 "ழ" 3031 "ள" 3016 "ன" 3000 "ஶ" 3382 "ஶ" 3064 "ஷ" 3391 "ி" 3392 "ி" 3398 "ெ" 3018 "ெஈ" 3020 "ெள" 3400 "ெெ" 3344 "ெഎ" 3399 "ே" 3019 "ேஈ" 3205 "అ" 3206 "ఆ" 3207 "ఇ" 3168 "ఋా" 3169 "ఌా" 3216 "ఐ" 3218 "ఒ" 3092 "ఒౌ" 3220 "ఒౌ" 3091 "ఒౕ" 3219 "ఒౕ" 3223 "గ" 3228 "జ" 3229 "ఝ" 3230 "ఞ" 3231 "ట" 3106 "డ̣" 3235 "ణ" 3238 "ద" 3109 "ధּ" 3240 "న" 3117 "బ̣" 3247 "య" 3248 "ర" 3104 "రּ" 3249 "ఱ" 3250 "ల" 3127 "వ̣" 3129 "వా" 3118 "వు" 3251 "ళ" 3263 "ి" 3265 "ు" 3138 "ుా" 3267 "ృ" 3140 "ృా" 3297 "ಌಾ" 3094 "ಖ̣" 3336 "ഇൗ" 3347 "ഒാ" 3348 "ഒൗ" 3425 "ഞ" 3435 "ദ്ര" 3449 "നു" 3340 "നു" 3353 "നു" 3439 "ന്" 3451 "ന്" 3436 "ന്ന" 3418 "ന്മ" 4312 "ര" 3377 "ര" 4098 "ര" 3434 "ര്" 3452 "ര്" 4225 "രှ" 4096 "രာ" 4131 "രာ္രာ" 3453 "ല്" 3438 "വ്ര" 3446 "ഹ്മ" 3454 "ള്" 3394 "ു" 3395 "ു" 3509 "එ" 3475 "එෙ" 3474 "එ්" 3513 "ඔ" 3510 "ඛ" 3520 "ච" 3562 "ජ" 3563 "ද" 3524 "භ" 3469 "සෘ" 70675 "𑐴𑑂𑐒" 70681 "𑐴𑑂𑐘" 70692 "𑐴𑑂𑐣" 70698 "𑐴𑑂𑐩" 70701 "𑐴𑑂𑐬" 70703 "𑐴𑑂𑐮" 71128 "𑖂" 71129 "𑖂" 71130 "𑖃" 71131 "𑖄" 71132 "𑖲" 71133 "𑖳" 3587 "ข" 3604 "ค" 3605 "ค" 3617 "ฆ" 3720 "จ" 3595 "ช" 3599 "ฎ" 3607 "ฑ" 3738 "บ" 3739 "ป" 3741 "ฝ" 3742 "พ" 3743 "ฟ" 3622 "ภ" 3725 "ย" 6100 "ฯ" 3653 "า" 3635 "̊า" 6071 "ิ" 6072 "ี" 6073 "ึ" 6074 "ื" 3768 "ุ" 3769 "ู" 3649 "เเ" 3804 "ຫນ" 3805 "ຫມ" 3763 "̊າ" 3842 "འུྂཿ" 3843 "འུྂ༔" 3946 "ར" 3840 "ཨོཾ" 3959 "ྲཱྀ" 3961 "ླཱྀ" 3963 "ེེ" 3965 "ོོ" 72882 "𑲪" 5940 "᜕" 4208 "ဃှ" 4198 "ပှ" 4127 "ပာ" 4207 "ပာှ" 4222 "ၽှ" 4193 "ရှ" 4137 "သြ" 4138 "သြେာ်" 4254 "ႃ̊" 6031 "ដ" 6051 "អ" 6608 "ᦞ" 6609 "ᦱ" 6784 "ᩅ" 6800 "ᩅ" 43603 "ꨁ" 43606 "ꨣ" 6994 "ᬍ" 6995 "ᬑ" 7000 "ᬨ" 43427 "ꦝ" 6294 "ᡜ" 6229 "ᠵ" 8182 "Ꮿ" 5133 "ᐁ·" 5163 "ᐁᐠ" 5137 "ᐄ·" 5139 "ᐅ·" 5165 "ᐅᐠ" 5141 "ᐆ·" 5144 "ᐊ·" 5166 "ᐊᐠ" 5146 "ᐋ·" 6365 "ᐞᣟ" 5329 "ᐡ" 5440 "ᐩ" 5183 "ᐲ·" 5187 "ᐴ·" 9065 "ᐵ" 5191 "ᐹ·" 5212 "ᑏ·" 11815 "ᑐ" 8835 "ᑐ" 5214 "ᑐ·" 5225 "ᑐ'" 10185 "ᑐ/" 10967 "ᑐᑕ" 5216 "ᑑ·" 11814 "ᑕ" 8834 "ᑕ" 5218 "ᑕ·" 5226 "ᑕ'" 5220 "ᑖ·" 5237 "ᑫ·" 5253 "ᑫ'" 5241 "ᑮ·" 5245 "ᑰ·" 5635 "ᒉ" 5267 "ᒉ·" 5269 "ᒋ·" 5271 "ᒌ·" 5275 "ᒎ·" 5634 "ᒐ" 5277 "ᒐ·" 5279 "ᒑ·" 5293 "ᒣ·" 5297 "ᒦ·" 5299 "ᒧ·" 5301 "ᒨ·" 5305 "ᒫ·" 5322 "ᓀ·" 6343 "ᓂ·" 6345 "ᓃ·" 6347 "ᓄ·" 6349 "ᓅ·" 5324 "ᓇ·" 5326 "ᓈ·" 5636 "ᓓ" 5341 "ᓓ·" 5343 "ᓕ·" 5345 "ᓖ·" 5347 "ᓗ·" 5349 "ᓘ·" 5639 "ᓚ" 5351 "ᓚ·" 5353 "ᓛ·" 5367 "ᓭ·" 5369 "ᓯ·" 5371 "ᓰ·" 5373 "ᓱ·" 5375 "ᓲ·" 5377 "ᓴ·" 5379 "ᓵ·" 5388 "ᔋ<" 5390 "ᔋb" 5389 "ᔋᑕ" 5391 "ᔋᒐ" 5400 "ᔐ·" 5402 "ᔑ·" 5404 "ᔒ·" 5406 "ᔓ·" 5408 "ᔔ·" 5410 "ᔕ·" 5412 "ᔖ·" 5426 "ᔨ·" 5428 "ᔩ·" 5430 "ᔪ·" 5432 "ᔫ·" 5434 "ᔭ·" 5436 "ᔮ·" 5666 "ᕃ" 6368 "ᕃ·" 5667 "ᕆ" 5668 "ᕊ" 5455 "ᕌ·" 5507 "ᕐb" 5508 "ᕐḃ" 5505 "ᕐd" 5503 "ᕐP" 5743 "ᕐᑫ" 5502 "ᕐᑬ" 5504 "ᕐᑮ" 5506 "ᕐᑰ" 5509 "ᕐᒃ" 5468 "ᕚ·" 6371 "ᕞ·" 6372 "ᕦ·" 5481 "ᕧ·" 6373 "ᕫ·" 6376 "ᖆ·" 5521 "ᖕJ" 5744 "ᖕᒉ" 5518 "ᖕᒊ" 5519 "ᖕᒋ" 5520 "ᖕᒌ" 5522 "ᖕᒎ" 5523 "ᖕᒐ" 5524 "ᖕᒑ" 5747 "ᖖJ" 5745 "ᖖᒋ" 5746 "ᖖᒌ" 5748 "ᖖᒎ" 5749 "ᖖᒐ" 5750 "ᖖᒑ" 6378 "ᖗ·" 5751 "ᖧ·" 5752 "ᖨ·" 5753 "ᖩ·" 5754 "ᖪ·" 5755 "ᖫ·" 5756 "ᖬ·" 5757 "ᖭ·" 10923 "ᗒ" 10922 "ᗕ" 42231 "ᗡ" 6384 "ᗴ·" 6386 "ᘛ·" 7611 "ᙆ" 42221 "ᙠ" 7610 "ᣔ" 7486 "ᣖ" 6364 "ᣟᐞ" 737 "ᣳ" 691 "ᣴ" 738 "ᣵ" 6363 "ᣵ" 42993 "ᣵ" 42672 "ᚹ" 5857 "ᚼ" 9087 "ᚽ" 5826 "ᚽ" 119359 "ᛋ" 8593 "ᛏ" 8639 "ᛐ" 10606 "ᛐ⇂" 10595 "ᛐᛚ" 11619 "ᛯ" 8638 "ᛚ" 10785 "ᛚ" 8900 "ᛜ" 9671 "ᛜ" 9674 "ᛜ" 9826 "ᛜ" 128852 "ᛜ" 71863 "ᛜ" 66196 "ᛜ" 9050 "ᛜ̲" 8904 "ᛞ" 10781 "ᛞ" 66768 "ᛦ" 8597 "ᛨ" 68860 "𐲂" 68858 "𐲥" 12593 "ᄀ" 4520 "ᄀ" 4353 "ᄀᄀ" 12594 "ᄀᄀ" 4521 "ᄀᄀ" 4602 "ᄀᄂ" 4442 "ᄀᄃ" 4547 "ᄀᄅ" 4603 "ᄀᄇ" 4522 "ᄀᄉ" 12595 "ᄀᄉ" 4548 "ᄀᄉᄀ" 4604 "ᄀᄎ" 4605 "ᄀᄏ" 4606 "ᄀᄒ" 12596 "ᄂ" 4523 "ᄂ" 4371 "ᄂᄀ" 4549 "ᄂᄀ" 4372 "ᄂᄂ" 12645 "ᄂᄂ" 4607 "ᄂᄂ" 4373 "ᄂᄃ" 12646 "ᄂᄃ" 4550 "ᄂᄃ" 55243 "ᄂᄅ" 4374 "ᄂᄇ" 4443 "ᄂᄉ" 4551 "ᄂᄉ" 12647 "ᄂᄉ" 4444 "ᄂᄌ" 4524 "ᄂᄌ" 12597 "ᄂᄌ" 55244 "ᄂᄎ" 4553 "ᄂᄐ" 4445 "ᄂᄒ" 4525 "ᄂᄒ" 12598 "ᄂᄒ" 4552 "ᄂᅀ" 12648 "ᄂᅀ" 29247 "누丨" 12121 "누丨" 12599 "ᄃ" 4526 "ᄃ" 4375 "ᄃᄀ" 4554 "ᄃᄀ" 4356 "ᄃᄃ" 12600 "ᄃᄃ" 55245 "ᄃᄃ" 55246 "ᄃᄃᄇ" 4446 "ᄃᄅ" 4555 "ᄃᄅ" 43360 "ᄃᄆ" 43361 "ᄃᄇ" 55247 "ᄃᄇ" 43362 "ᄃᄉ" 55248 "ᄃᄉ" 55249 "ᄃᄉᄀ" 43363 "ᄃᄌ" 55250 "ᄃᄌ" 55251 "ᄃᄎ" 55252 "ᄃᄐ" 12601 "ᄅ" 4527 "ᄅ" 43364 "ᄅᄀ" 4528 "ᄅᄀ" 12602 "ᄅᄀ" 43365 "ᄅᄀᄀ" 55253 "ᄅᄀᄀ" 4556 "ᄅᄀᄉ" 12649 "ᄅᄀᄉ" 55254 "ᄅᄀᄒ" 4376 "ᄅᄂ" 4557 "ᄅᄂ" 43366 "ᄅᄃ" 4558 "ᄅᄃ" 12650 "ᄅᄃ" 43367 "ᄅᄃᄃ" 4559 "ᄅᄃᄒ" 4377 "ᄅᄅ" 4560 "ᄅᄅ" 55255 "ᄅᄅᄏ" 43368 "ᄅᄆ" 4529 "ᄅᄆ" 12603 "ᄅᄆ" 4561 "ᄅᄆᄀ" 4562 "ᄅᄆᄉ" 55256 "ᄅᄆᄒ" 43369 "ᄅᄇ" 4530 "ᄅᄇ" 12604 "ᄅᄇ" 55257 "ᄅᄇᄃ" 43370 "ᄅᄇᄇ" 4563 "ᄅᄇᄉ" 12651 "ᄅᄇᄉ" 43371 "ᄅᄇᄋ" 4565 "ᄅᄇᄋ" 55258 "ᄅᄇᄑ" 4564 "ᄅᄇᄒ" 43372 "ᄅᄉ" 4531 "ᄅᄉ" 12605 "ᄅᄉ" 4566 "ᄅᄉᄉ" 4379 "ᄅᄋ" 55261 "ᄅᄋ" 43373 "ᄅᄌ" 43374 "ᄅᄏ" 4568 "ᄅᄏ" 4532 "ᄅᄐ" 12606 "ᄅᄐ" 4533 "ᄅᄑ" 12607 "ᄅᄑ" 4378 "ᄅᄒ" 12608 "ᄅᄒ" 4411 "ᄅᄒ" 4534 "ᄅᄒ" 55282 "ᄅᄒ" 4567 "ᄅᅀ" 12652 "ᄅᅀ" 55259 "ᄅᅌ" 4569 "ᄅᅙ" 12653 "ᄅᅙ" 55260 "ᄅᅙᄒ" 12609 "ᄆ" 4535 "ᄆ" 43375 "ᄆᄀ" 4570 "ᄆᄀ" 55262 "ᄆᄂ" 55263 "ᄆᄂᄂ" 43376 "ᄆᄃ" 4571 "ᄆᄅ" 55264 "ᄆᄆ" 4380 "ᄆᄇ" 12654 "ᄆᄇ" 4572 "ᄆᄇ" 55265 "ᄆᄇᄉ" 43377 "ᄆᄉ" 4573 "ᄆᄉ" 12655 "ᄆᄉ" 4574 "ᄆᄉᄉ" 4381 "ᄆᄋ" 12657 "ᄆᄋ" 4578 "ᄆᄋ" 55266 "ᄆᄌ" 4576 "ᄆᄎ" 4577 "ᄆᄒ" 4575 "ᄆᅀ" 12656 "ᄆᅀ" 21343 "마" 12610 "ᄇ" 4536 "ᄇ" 4382 "ᄇᄀ" 12658 "ᄇᄀ" 4383 "ᄇᄂ" 4384 "ᄇᄃ" 12659 "ᄇᄃ" 55267 "ᄇᄃ" 4579 "ᄇᄅ" 55268 "ᄇᄅᄑ" 55269 "ᄇᄆ" 4360 "ᄇᄇ" 12611 "ᄇᄇ" 55270 "ᄇᄇ" 4396 "ᄇᄇᄋ" 12665 "ᄇᄇᄋ" 4385 "ᄇᄉ" 12612 "ᄇᄉ" 4537 "ᄇᄉ" 4386 "ᄇᄉᄀ" 12660 "ᄇᄉᄀ" 4387 "ᄇᄉᄃ" 12661 "ᄇᄉᄃ" 55271 "ᄇᄉᄃ" 4388 "ᄇᄉᄇ" 4389 "ᄇᄉᄉ" 4390 "ᄇᄉᄌ" 43378 "ᄇᄉᄐ" 4395 "ᄇᄋ" 12664 "ᄇᄋ" 4582 "ᄇᄋ" 4391 "ᄇᄌ" 12662 "ᄇᄌ" 55272 "ᄇᄌ" 4392 "ᄇᄎ" 55273 "ᄇᄎ" 43379 "ᄇᄏ" 4393 "ᄇᄐ" 12663 "ᄇᄐ" 4394 "ᄇᄑ" 4580 "ᄇᄑ" 43380 "ᄇᄒ" 4581 "ᄇᄒ" 12613 "ᄉ" 4538 "ᄉ" 20170 "ᄉーᄀ" 21512 "ᄉーᄆ" 4397 "ᄉᄀ" 12666 "ᄉᄀ" 4583 "ᄉᄀ" 4398 "ᄉᄂ" 12667 "ᄉᄂ" 4399 "ᄉᄃ" 12668 "ᄉᄃ" 4584 "ᄉᄃ" 4400 "ᄉᄅ" 4585 "ᄉᄅ" 4401 "ᄉᄆ" 55274 "ᄉᄆ" 4402 "ᄉᄇ" 12669 "ᄉᄇ" 4586 "ᄉᄇ" 4403 "ᄉᄇᄀ" 55275 "ᄉᄇᄋ" 4362 "ᄉᄉ" 12614 "ᄉᄉ" 4539 "ᄉᄉ" 19995 "ᄉᄉー" 55276 "ᄉᄉᄀ" 55277 "ᄉᄉᄃ" 43381 "ᄉᄉᄇ" 4404 "ᄉᄉᄉ" 4405 "ᄉᄋ" 4406 "ᄉᄌ" 12670 "ᄉᄌ" 55279 "ᄉᄌ" 4407 "ᄉᄎ" 55280 "ᄉᄎ" 4408 "ᄉᄏ" 4409 "ᄉᄐ" 55281 "ᄉᄐ" 4410 "ᄉᄑ" 55278 "ᄉᅀ" 12615 "ᄋ" 4540 "ᄋ" 4417 "ᄋᄀ" 4588 "ᄋᄀ" 4589 "ᄋᄀᄀ" 4418 "ᄋᄃ" 43382 "ᄋᄅ" 4419 "ᄋᄆ" 4420 "ᄋᄇ" 4421 "ᄋᄉ" 4593 "ᄋᄉ" 12674 "ᄋᄉ" 4423 "ᄋᄋ" 12672 "ᄋᄋ" 4590 "ᄋᄋ" 4424 "ᄋᄌ" 4425 "ᄋᄎ" 4591 "ᄋᄏ" 4426 "ᄋᄐ" 4427 "ᄋᄑ" 43383 "ᄋᄒ" 4422 "ᄋᅀ" 4594 "ᄋᅀ" 12675 "ᄋᅀ" 12616 "ᄌ" 4541 "ᄌ" 55287 "ᄌᄇ" 55288 "ᄌᄇᄇ" 4429 "ᄌᄋ" 4365 "ᄌᄌ" 12617 "ᄌᄌ" 55289 "ᄌᄌ" 43384 "ᄌᄌᄒ" 19989 "조" 12618 "ᄎ" 4542 "ᄎ" 4434 "ᄎᄏ" 4435 "ᄎᄒ" 12619 "ᄏ" 4543 "ᄏ" 12620 "ᄐ" 4544 "ᄐ" 38263 "ᄐーᄂᄌ" 11985 "ᄐーᄂᄌ" 12199 "ᄐーᄂᄌ" 43385 "ᄐᄐ" 12621 "ᄑ" 4545 "ᄑ" 4438 "ᄑᄇ" 4595 "ᄑᄇ" 55290 "ᄑᄉ" 4439 "ᄑᄋ" 12676 "ᄑᄋ" 4596 "ᄑᄋ" 55291 "ᄑᄐ" 43386 "ᄑᄒ" 12622 "ᄒ" 4546 "ᄒ" 4597 "ᄒᄂ" 4598 "ᄒᄅ" 4599 "ᄒᄆ" 4600 "ᄒᄇ" 43387 "ᄒᄉ" 4440 "ᄒᄒ" 12677 "ᄒᄒ" 4413 "ᄼᄼ" 4415 "ᄾᄾ" 12671 "ᅀ" 4587 "ᅀ" 55283 "ᅀᄇ" 55284 "ᅀᄇᄋ" 12673 "ᅌ" 4592 "ᅌ" 55285 "ᅌᄆ" 55286 "ᅌᄒ" 4431 "ᅎᅎ" 4433 "ᅐᅐ" 12678 "ᅙ" 4601 "ᅙ" 43388 "ᅙᅙ" 12644 "ᅠ" 12623 "ᅡ" 4515 "ᅡー" 4470 "ᅡᅩ" 4471 "ᅡᅮ" 4450 "ᅡ丨" 12624 "ᅡ丨" 12625 "ᅣ" 4472 "ᅣᅩ" 4473 "ᅣᅭ" 4516 "ᅣᅮ" 4452 "ᅣ丨" 12626 "ᅣ丨" 12627 "ᅥ" 4476 "ᅥー" 4474 "ᅥᅩ" 4475 "ᅥᅮ" 4454 "ᅥ丨" 12628 "ᅥ丨" 12629 "ᅧ" 4517 "ᅧᅣ" 4477 "ᅧᅩ" 4478 "ᅧᅮ" 4456 "ᅧ丨" 12630 "ᅧ丨" 12631 "ᅩ" 4458 "ᅩᅡ" 12632 "ᅩᅡ" 4459 "ᅩᅡ丨" 12633 "ᅩᅡ丨" 4518 "ᅩᅣ" 4519 "ᅩᅣ丨" 4479 "ᅩᅥ" 4480 "ᅩᅥ丨" 55216 "ᅩᅧ" 4481 "ᅩᅧ丨" 4482 "ᅩᅩ" 55217 "ᅩᅩ丨" 4483 "ᅩᅮ" 4460 "ᅩ丨" 12634 "ᅩ丨" 12635 "ᅭ" 55218 "ᅭᅡ" 55219 "ᅭᅡ丨" 4484 "ᅭᅣ" 12679 "ᅭᅣ" 4486 "ᅭᅣ" 4485 "ᅭᅣ丨" 12680 "ᅭᅣ丨" 55220 "ᅭᅥ" 4487 "ᅭᅩ" 4488 "ᅭ丨" 12681 "ᅭ丨" 12636 "ᅮ" 4489 "ᅮᅡ" 4490 "ᅮᅡ丨" 4463 "ᅮᅥ" 12637 "ᅮᅥ" 4491 "ᅮᅥー" 4464 "ᅮᅥ丨" 12638 "ᅮᅥ丨" 55221 "ᅮᅧ" 4492 "ᅮᅧ丨" 4493 "ᅮᅮ" 4465 "ᅮ丨" 12639 "ᅮ丨" 55222 "ᅮ丨丨" 12640 "ᅲ" 4494 "ᅲᅡ" 55223 "ᅲᅡ丨" 4495 "ᅲᅥ" 4496 "ᅲᅥ丨" 4497 "ᅲᅧ" 12682 "ᅲᅧ" 4498 "ᅲᅧ丨" 12683 "ᅲᅧ丨" 55224 "ᅲᅩ" 4499 "ᅲᅮ" 4500 "ᅲ丨" 12684 "ᅲ丨" 12685 "ᆞ" 55237 "ᆞᅡ" 4511 "ᆞᅥ" 55238 "ᆞᅥ丨" 4512 "ᆞᅮ" 4514 "ᆞᆞ" 4513 "ᆞ丨" 12686 "ᆞ丨" 12504 "へ" 9025 "〼" 10692 "〼" 20110 "𛄢" 42142 "ꁊ" 42156 "ꁐ" 42140 "ꃀ" 42152 "ꄲ" 42175 "ꉙ" 42174 "ꊱ" 42132 "ꋍ" 42176 "ꎫ" 42178 "ꎵ" 42170 "ꎿ" 42160 "ꏂ" 42151 "ꑘ" 8869 "ꓕ" 10178 "ꓕ" 119324 "ꓕ" 42929 "ꓕ" 42910 "ꓤ" 8513 "ꓨ" 8514 "ꓶ" 119317 "ꓶ" 119339 "ꓶ" 93990 "ꓶ" 66577 "ꓶ" 8515 "𖼀" 72422 "𑫥𑫯" 72424 "𑫥𑫥" 72425 "𑫥𑫥𑫯" 72426 "𑫥𑫥𑫰" 72423 "𑫥𑫰" 72436 "𑫳𑫯" 72438 "𑫳𑫳" 72439 "𑫳𑫳𑫯" 72440 "𑫳𑫳𑫰" 72437 "𑫳𑫰" 72428 "𑫫𑫯" 72429 "𑫫𑫫" 72430 "𑫫𑫫𑫯" 8853 "𐊨" 10753 "𐊨" 128808 "𐊨" 42650 "𐊨" 9661 "𐊼" 119316 "𐊼" 128772 "𐊼" 10710 "𐋀" 42907 "𐐺" 42906 "𐐒" 66720 "𐒆" 66513 "𐎂" 66515 "𐎓" 73784 "𐎚" 9765 "𐦞" 78585 "𐦞" 12345 "卄" 63847 "不" 194560 "丽" 64112 "並" 9116 "丨" 9119 "丨" 9122 "丨" 9125 "丨" 9130 "丨" 9134 "丨" 12753 "丨" 4469 "丨" 12643 "丨" 12033 "丨" 4508 "丨ー" 4504 "丨ᅡ" 4505 "丨ᅣ" 55229 "丨ᅣᅩ" 55230 "丨ᅣ丨" 55231 "丨ᅧ" 55232 "丨ᅧ丨" 4506 "丨ᅩ" 55233 "丨ᅩ丨" 55234 "丨ᅭ" 4507 "丨ᅮ" 55235 "丨ᅲ" 4509 "丨ᆞ" 55236 "丨丨" 63749 "串" 194561 "丸" 63838 "丹" 194562 "乁" 12768 "乙" 12036 "乙" 12767 "乚" 11907 "乚" 12758 "乛" 11906 "乛" 12018 "亀" 63771 "亂" 12762 "亅" 12037 "亅" 63930 "了" 12491 "二" 12038 "二" 194563 "𠄢" 12039 "亠" 63863 "亮" 12040 "人" 12452 "亻" 11909 "亻" 63997 "什" 194585 "仌" 63912 "令" 194564 "你" 20482 "併" 194567 "併" 64115 "侀" 63789 "來" 63925 "例" 64048 "侮" 194565 "侮" 194566 "侻" 63845 "便" 20540 "値" 63956 "倫" 194568 "偺" 194569 "備" 194571 "像" 63931 "僚" 64049 "僧" 194570 "僧" 194572 "㒞" 12582 "儿" 12041 "儿" 94194 "儿" 64012 "兀" 11918 "兀" 64116 "充" 64050 "免" 194574 "免" 194575 "兔" 194576 "兤" 12042 "入" 194580 "內" 64114 "全" 63864 "兩" 12495 "八" 12043 "八" 63953 "六" 194577 "具" 194578 "𠔜" 194843 "𠔥" 64117 "冀" 194579 "㒹" 12044 "冂" 194581 "再" 194582 "𠕋" 194770 "冒" 194771 "冕" 195018 "㒻" 194772 "最" 12045 "冖" 194583 "冗" 194584 "冤" 12046 "冫" 194586 "冬" 64113 "况" 194587 "况" 63790 "冷" 63865 "凉" 63829 "凌" 63828 "凜" 64021 "凞" 12047 "几" 194573 "𠘺" 194589 "凵" 12048 "凵" 132724 "凵" 12049 "刀" 11913 "刂" 194590 "刃" 64000 "切" 194640 "切" 63900 "列" 63965 "利" 194591 "㓟" 63999 "刺" 194592 "刻" 194593 "剆" 194594 "割" 194595 "剷" 63943 "劉" 195033 "𠠄" 12459 "力" 63882 "力" 12050 "力" 63901 "劣" 194596 "㔕" 194962 "劳" 64118 "勇" 194597 "勇" 64051 "勉" 194598 "勉" 63826 "勒" 63791 "勞" 64052 "勤" 194599 "勤" 63871 "勵" 12051 "勹" 64119 "勺" 194600 "勺" 194601 "包" 194602 "匆" 195037 "𠣞" 12052 "匕" 63843 "北" 194603 "北" 12053 "匚" 12054 "匸" 63979 "匿" 12055 "十" 12344 "十" 12346 "卅" 194604 "卉" 4054 "卍" 4053 "卐" 64053 "卑" 194605 "卑" 184673 "卑" 194606 "博" 12488 "卜" 12056 "卜" 12057 "卩" 11915 "㔾" 194607 "即" 63772 "卵" 194608 "卽" 194609 "卿" 194610 "卿" 194611 "卿" 12058 "厂" 194612 "𠨬" 12059 "厶" 63851 "參" 12060 "又" 194614 "及" 194615 "叟" 194616 "𠭣" 12525 "口" 12061 "口" 22231 "口" 12062 "口" 63750 "句" 194617 "叫" 194618 "叱" 194619 "吆" 63966 "吏" 63981 "吝" 194621 "吸" 63872 "呂" 194622 "呈" 194623 "周" 194620 "咞" 194624 "咢" 63902 "咽" 17307 "㖈" 194625 "哶" 194626 "唐" 194627 "啓" 21855 "啓" 64121 "啕" 194628 "啣" 194629 "善" 194630 "善" 63755 "喇" 64122 "喙" 194631 "喙" 64054 "喝" 64120 "喝" 194632 "喫" 194633 "喳" 64013 "嗀" 194634 "嗂" 64123 "嗢" 64055 "嘆" 194636 "嘆" 194638 "噑" 194639 "噴" 64056 "器" 63913 "囹" 194635 "圖" 194637 "圗" 12063 "土" 22763 "土" 12064 "土" 194645 "型" 194642 "城" 14771 "㘽" 194643 "埴" 194644 "堍" 194647 "報" 194646 "堲" 64057 "塀" 64016 "塚" 64124 "塚" 63852 "塞" 22635 "塡" 22783 "墫" 194648 "墬" 64125 "墳" 63818 "壘" 63810 "壟" 194649 "𡓤" 194641 "壮" 194650 "売" 194651 "壷" 136499 "壷" 12065 "夂" 194652 "夆" 12066 "夊" 12479 "夕" 12067 "夕" 194653 "多" 136583 "多" 194654 "夢" 12068 "大" 64126 "奄" 63756 "奈" 64127 "奔" 63753 "契" 194655 "奢" 63873 "女" 12069 "女" 136871 "𡚨" 194656 "𡚨" 194657 "𡛪" 194661 "姘" 194658 "姬" 194659 "娛" 194660 "娧" 64128 "婢" 194662 "婦" 23296 "媯" 194663 "㛮" 194664 "㛼" 194950 "媵" 194665 "嬈" 64129 "嬨" 194666 "嬾" 194667 "嬾" 12070 "子" 12071 "宀" 64004 "宅" 194668 "𡧈" 194669 "寃" 194670 "寘" 63839 "寧" 63914 "寧" 194671 "寧" 63932 "寮" 194672 "寳" 194673 "𡬘" 12072 "寸" 194674 "寿" 194675 "将" 12073 "小" 194677 "尢" 11920 "尢" 12074 "尢" 11919 "尣" 194678 "㞁" 12075 "尸" 63933 "尿" 194679 "屠" 63819 "屢" 64059 "層" 63967 "履" 64060 "屮" 194680 "屮" 12076 "屮" 194808 "𡴋" 12077 "山" 194681 "峀" 177978 "峀" 194682 "岍" 194683 "𡷤" 194685 "𡷦" 63957 "崙" 194684 "嵃" 63777 "嵐" 194687 "嵫" 194686 "嵮" 194688 "嵼" 195060 "嶲" 63915 "嶺" 12078 "巛" 194690 "巢" 12456 "工" 12079 "工" 12080 "己" 11922 "巳" 194691 "㠯" 194692 "巽" 12081 "巾" 24114 "帡" 194693 "帨" 194694 "帽" 194695 "幩" 194696 "㡢" 194697 "𢆃" 12082 "干" 63886 "年" 194873 "𢆟" 11923 "幺" 12083 "幺" 12084 "广" 64001 "度" 194698 "㡼" 194699 "庰" 194700 "庳" 194701 "庶" 63784 "廊" 194702 "廊" 63906 "廉" 64130 "廒" 64011 "廓" 64131 "廙" 63874 "廬" 12085 "廴" 194704 "廾" 12086 "廾" 194705 "𢌱" 194706 "𢌱" 63811 "弄" 12087 "弋" 12088 "弓" 194708 "弢" 194709 "弢" 12089 "彐" 11924 "彑" 194676 "当" 194710 "㣇" 12090 "彡" 194713 "形" 64132 "彩" 194714 "彫" 12091 "彳" 63960 "律" 194715 "㣣" 140549 "徚" 194716 "徚" 63846 "復" 64133 "徭" 12092 "心" 11926 "忄" 11927 "㣺" 194717 "忍" 194718 "志" 63907 "念" 194719 "忹" 63840 "怒" 63916 "怜" 64107 "恵" 194722 "㤜" 194721 "㤺" 194720 "悁" 64061 "悔" 194723 "悔" 194725 "惇" 64134 "惘" 63929 "惡" 194724 "𢛔" 64136 "愈" 64062 "慨" 63961 "慄" 194726 "慈" 194727 "慌" 194729 "慌" 64135 "慎" 194728 "慎" 64138 "慠" 194730 "慺" 64063 "憎" 64137 "憎" 194731 "憎" 63887 "憐" 194733 "憤" 194734 "憯" 194732 "憲" 64208 "𢡄" 64207 "𢡊" 194735 "懞" 64064 "懲" 64139 "懲" 194736 "懲" 63757 "懶" 194737 "懶" 63888 "戀" 12093 "戈" 194738 "成" 194739 "戛" 63954 "戮" 64140 "戴" 12094 "戶" 25144 "戶" 12095 "手" 11928 "扌" 194740 "扝" 194741 "抱" 63781 "拉" 63835 "拏" 64002 "拓" 194742 "拔" 194746 "拼" 63859 "拾" 194744 "𢬌" 194745 "挽" 194743 "捐" 194747 "捨" 63908 "捻" 194748 "掃" 63861 "掠" 194753 "掩" 64141 "揄" 194749 "揤" 64142 "搜" 194750 "𢯱" 194751 "搢" 194752 "揅" 64143 "摒" 194755 "摩" 194758 "摷" 194756 "摾" 194754 "㨮" 25609 "㩁" 63889 "撚" 194757 "撝" 63792 "擄" 194759 "㩬" 12096 "支" 12097 "攴" 11929 "攵" 64065 "敏" 194760 "敏" 64144 "敖" 194761 "敬" 63849 "數" 194762 "𣀊" 12098 "文" 12011 "斉" 12099 "斗" 63934 "料" 12100 "斤" 12101 "方" 63875 "旅" 12102 "无" 11931 "旡" 64066 "既" 194763 "旣" 12103 "日" 63968 "易" 26358 "㫚" 194769 "㫤" 194765 "晉" 26217 "晚" 64018 "晴" 64145 "晴" 64067 "暑" 194767 "暑" 63941 "暈" 194768 "㬈" 194773 "暜" 64006 "暴" 63883 "曆" 194766 "㬙" 194711 "𣊸" 12104 "曰" 63745 "更" 194764 "書" 12105 "月" 194944 "𣍟" 177982 "𣍟" 32934 "朌" 32976 "朏" 32970 "朐" 33025 "朓" 33014 "㬵" 63785 "朗" 64146 "朗" 194776 "朗" 33063 "朘" 64147 "望" 194777 "望" 24144 "㬺" 17440 "㬻" 194953 "𣎓" 33191 "朣" 194954 "𣎜" 12106 "木" 63969 "李" 194780 "杓" 64148 "杖" 194779 "杞" 194781 "𣏃" 26623 "杮" 63944 "杻" 194784 "枅" 63988 "林" 194782 "㭉" 64209 "𣏕" 63945 "柳" 194783 "柺" 63962 "栗" 194789 "栟" 194785 "桒" 194787 "𣑭" 63866 "梁" 64068 "梅" 194786 "梅" 194788 "梎" 63970 "梨" 194790 "椔" 194792 "楂" 64210 "㮝" 194791 "㮝" 27113 "㮣" 27175 "榝" 194793 "榣" 194794 "槪" 63764 "樂" 63836 "樂" 63935 "樂" 63820 "樓" 194796 "𣚣" 194795 "檨" 63793 "櫓" 194797 "櫛" 63773 "欄" 194798 "㰘" 12107 "欠" 194799 "次" 194800 "𣢧" 194801 "歔" 194802 "㱎" 12108 "止" 12013 "歯" 194803 "歲" 63884 "歷" 64149 "歹" 12109 "歹" 11934 "歺" 194804 "殟" 63909 "殮" 12110 "殳" 63856 "殺" 64150 "殺" 194805 "殺" 194806 "殻" 194807 "𣪍" 12111 "毋" 11935 "母" 194809 "𣫺" 12112 "比" 12113 "毛" 12114 "氏" 11936 "民" 12115 "气" 12116 "水" 11937 "氵" 11938 "氺" 194810 "汎" 194814 "汧" 63858 "沈" 194812 "沿" 63848 "泌" 194813 "泍" 63971 "泥" 194811 "𣲼" 63765 "洛" 64005 "洞" 194823 "洴" 194816 "派" 63946 "流" 64151 "流" 194818 "流" 194815 "洖" 194819 "浩" 63786 "浪" 64069 "海" 194817 "海" 194820 "浸" 194821 "涅" 146752 "涅" 194822 "𣴞" 63989 "淋" 63821 "淚" 63958 "淪" 194830 "淹" 64070 "渚" 194824 "港" 194825 "湮" 28505 "溈" 64153 "滋" 194827 "滋" 63947 "溜" 63980 "溺" 194828 "滇" 63748 "滑" 64152 "滛" 194826 "㴳" 63822 "漏" 64071 "漢" 64154 "漢" 63890 "漣" 194829 "𣻑" 194831 "潮" 194832 "𣽞" 194833 "𣾎" 194834 "濆" 63778 "濫" 63876 "濾" 194837 "瀛" 64155 "瀞" 194836 "瀞" 194835 "瀹" 194839 "灊" 194838 "㶖" 12117 "火" 11939 "灬" 194613 "灰" 194841 "灷" 194840 "災" 63995 "炙" 194842 "炭" 63903 "烈" 63766 "烙" 64072 "煮" 64156 "煮" 194845 "𤉣" 194844 "煅" 63891 "煉" 64108 "𤋮" 194846 "熜" 63936 "燎" 63982 "燐" 194847 "𤎫" 63794 "爐" 63774 "爛" 194848 "爨" 12118 "爪" 64073 "爫" 11940 "爫" 64158 "爵" 194849 "爵" 12119 "父" 12120 "爻" 11942 "丬" 12122 "片" 194850 "牐" 12123 "牙" 194851 "𤘈" 12124 "牛" 63814 "牢" 194852 "犀" 194853 "犕" 12125 "犬" 11944 "犭" 64159 "犯" 63994 "狀" 194854 "𤜵" 63787 "狼" 64022 "猪" 64160 "猪" 175813 "𤠔" 194855 "𤠔" 63911 "獵" 194856 "獺" 12126 "玄" 63841 "率" 63963 "率" 12127 "玉" 194857 "王" 194858 "㺬" 194859 "玥" 149757 "玥" 63917 "玲" 194860 "㺸" 194861 "㺸" 63767 "珞" 63948 "琉" 63972 "理" 64074 "琢" 194862 "瑇" 194863 "瑜" 63918 "瑩" 64161 "瑱" 194864 "瑱" 194865 "璅" 63892 "璉" 63983 "璘" 194866 "瓊" 12128 "瓜" 12129 "瓦" 194867 "㼛" 64162 "甆" 12130 "甘" 12131 "生" 194868 "甤" 12132 "用" 12133 "田" 64163 "画" 194870 "甾" 194869 "𤰶" 63949 "留" 63862 "略" 63842 "異" 194872 "異" 194871 "𤲒" 12134 "疋" 12135 "疒" 63973 "痢" 194874 "瘐" 64165 "瘟" 64164 "瘝" 63937 "療" 63758 "癩" 12136 "癶" 12137 "白" 194875 "𤾡" 194876 "𤾸" 12138 "皮" 12139 "皿" 194877 "𥁄" 194878 "㿼" 64023 "益" 64166 "益" 64167 "盛" 63795 "盧" 194879 "䀈" 12140 "目" 64168 "直" 194880 "直" 194882 "𥃲" 194881 "𥃳" 63853 "省" 64211 "䀘" 194883 "𥄙" 151834 "𥄙" 194885 "眞" 194886 "真" 194887 "真" 194884 "𥄳" 64170 "着" 64169 "睊" 194888 "睊" 40899 "䀹" 64212 "䀹" 194889 "䀹" 26211 "䀿" 194891 "䁆" 194890 "瞋" 64213 "𥉉" 64157 "瞧" 12141 "矛" 12142 "矢" 12143 "石" 194892 "䂖" 194893 "𥐝" 30799 "研" 194894 "硎" 63950 "硫" 63803 "碌" 194895 "碌" 64075 "碑" 63815 "磊" 64171 "磌" 194896 "磌" 63844 "磻" 194897 "䃣" 63877 "礪" 12144 "示" 11949 "礻" 64024 "礼" 64076 "社" 64078 "祈" 64077 "祉" 194898 "𥘦" 64079 "祐" 64080 "祖" 194899 "祖" 64081 "祝" 64025 "神" 64026 "祥" 64097 "視" 64184 "視" 63804 "祿" 194900 "𥚚" 64082 "禍" 64083 "禎" 64027 "福" 194902 "福" 194901 "𥛅" 63926 "禮" 12145 "禸" 12146 "禾" 63893 "秊" 194904 "䄯" 194903 "秫" 63830 "稜" 194906 "穊" 64084 "穀" 194905 "穀" 194907 "穏" 12147 "穴" 64085 "突" 194908 "𥥼" 64172 "窱" 63991 "立" 12148 "立" 12015 "竜" 194909 "𥪧" 194910 "𥪧" 194911 "竮" 12149 "竹" 63992 "笠" 64086 "節" 64173 "節" 194912 "䈂" 194913 "𥮫" 194914 "篆" 194916 "䈧" 194915 "築" 194917 "𥲀" 64214 "𥳐" 63910 "簾" 63812 "籠" 12150 "米" 64174 "类" 63993 "粒" 64029 "精" 194918 "糒" 64003 "糖" 194920 "糨" 194919 "䊠" 194921 "糣" 63867 "糧" 12151 "糸" 11951 "糹" 194923 "𥾆" 194922 "紀" 63951 "紐" 63850 "索" 63823 "累" 32118 "絕" 194924 "絣" 64175 "絛" 63805 "綠" 63831 "綾" 194926 "緇" 204412 "緇" 63894 "練" 64087 "練" 64176 "練" 194927 "縂" 194925 "䌁" 64088 "縉" 63824 "縷" 64089 "繁" 194928 "繅" 194712 "𦇚" 194929 "䌴" 12152 "缶" 194930 "𦈨" 64177 "缾" 194931 "𦉇" 12153 "网" 11947 "罒" 11954 "罒" 11953 "罓" 194932 "䍙" 64090 "署" 194933 "𦋙" 63974 "罹" 194934 "罺" 63759 "羅" 194935 "𦌾" 12154 "羊" 194936 "羕" 63919 "羚" 64030 "羽" 12155 "羽" 194937 "翺" 63796 "老" 12156 "老" 11961 "耂" 64091 "者" 64178 "者" 194938 "者" 12157 "而" 194939 "𦓚" 12158 "耒" 194940 "𦔣" 12159 "耳" 63920 "聆" 194941 "聠" 157085 "𦖨" 194942 "𦖨" 63895 "聯" 194943 "聰" 63813 "聾" 12160 "聿" 11962 "肀" 12161 "肉" 63827 "肋" 194774 "肭" 194946 "育" 194945 "䏕" 194775 "䏙" 33089 "胼" 194947 "脃" 194949 "脾" 194948 "䐋" 194778 "朡" 194951 "𦞧" 194952 "𦞵" 26406 "䑃" 63782 "臘" 12162 "臣" 63990 "臨" 12163 "自" 64092 "臭" 12164 "至" 12165 "臼" 194707 "舁" 194955 "舁" 194956 "舄" 12166 "舌" 64109 "舘" 12167 "舛" 12168 "舟" 194958 "䑫" 12169 "艮" 63868 "良" 12170 "色" 12171 "艸" 64093 "艹" 64094 "艹" 11966 "艹" 11967 "艹" 11968 "艹" 194960 "芋" 194959 "芑" 194961 "芝" 194963 "花" 194964 "芳" 194965 "芽" 63860 "若" 194968 "若" 194966 "苦" 194967 "𦬼" 63998 "茶" 64179 "荒" 194970 "荣" 194969 "茝" 194972 "茣" 194973 "莽" 194976 "荓" 63806 "菉" 194977 "菊" 194978 "菌" 194979 "菜" 194974 "菧" 64180 "華" 63832 "菱" 64095 "著" 194975 "著" 194980 "𦰶" 158982 "𦰶" 194971 "莭" 63768 "落" 63854 "葉" 34111 "蒍" 194982 "𦳕" 194981 "𦵫" 63897 "蓮" 194984 "蓱" 194985 "蓳" 63938 "蓼" 194986 "蔖" 194983 "䔫" 194988 "蕤" 194989 "𦼬" 63779 "藍" 194990 "䕝" 194992 "𦾱" 194991 "䕡" 63984 "藺" 63797 "蘆" 194994 "䕫" 64032 "蘒" 63775 "蘭" 194993 "𧃒" 34369 "蘷" 63760 "蘿" 12172 "虍" 11969 "虎" 194995 "虐" 63798 "虜" 194996 "虜" 194997 "虧" 194998 "虩" 12173 "虫" 194999 "蚩" 195000 "蚈" 195002 "蛢" 195001 "蜎" 195004 "蜨" 195005 "蝫" 195008 "蟡" 64181 "蝹" 195003 "蝹" 195006 "螆" 195007 "䗗" 194987 "𧏊" 63761 "螺" 195009 "蠁" 195010 "䗹" 63783 "蠟" 12174 "血" 64008 "行" 12175 "行" 195011 "衠" 195012 "衣" 12176 "衣" 11970 "衤" 63904 "裂" 195013 "𧙧" 63975 "裏" 195014 "裗" 195015 "裞" 63976 "裡" 63762 "裸" 195017 "裺" 195016 "䘵" 64096 "褐" 64182 "襁" 63780 "襤" 12177 "襾" 11972 "西" 11971 "覀" 64183 "覆" 64010 "見" 12178 "見" 11973 "见" 18069 "𧢮" 195019 "𧢮" 12179 "角" 12180 "言" 11976 "讠" 195020 "𧥦" 35453 "訮" 35358 "䚶" 195021 "䚾" 195022 "䛇" 195023 "誠" 63855 "說" 63905 "說" 64185 "調" 64187 "請" 63869 "諒" 63809 "論" 64190 "諭" 195024 "諭" 64034 "諸" 64186 "諸" 63837 "諾" 64189 "諾" 64098 "謁" 64188 "謁" 64099 "謹" 64191 "謹" 63996 "識" 63834 "讀" 35727 "讆" 64192 "變" 195025 "變" 12181 "谷" 12182 "豆" 63744 "豈" 195026 "豕" 12183 "豕" 35939 "豜" 12184 "豸" 195027 "𧲨" 12185 "貝" 11977 "贝" 195028 "貫" 195029 "賁" 63816 "賂" 63747 "賈" 64100 "賓" 64101 "贈" 64193 "贈" 154324 "贛" 195030 "贛" 12186 "赤" 12187 "走" 195031 "起" 36230 "赿" 64215 "𧻓" 195032 "𧼯" 12188 "足" 195034 "跋" 195035 "趼" 36346 "跥" 63799 "路" 195036 "跰" 36507 "躗" 12189 "身" 63746 "車" 12190 "車" 11979 "车" 195038 "軔" 36647 "軿" 63896 "輦" 63959 "輪" 64194 "輸" 195039 "輸" 64007 "輻" 63885 "轢" 12191 "辛" 194957 "辞" 63857 "辰" 12192 "辰" 12193 "辵" 64102 "辶" 11980 "辶" 11981 "辶" 194689 "巡" 63898 "連" 64037 "逸" 64103 "逸" 64195 "遲" 63939 "遼" 195040 "𨗒" 195041 "𨗭" 63763 "邏" 12194 "邑" 195042 "邔" 63788 "郎" 37086 "郎" 64046 "郎" 195043 "郱" 64038 "都" 195045 "𨜮" 195044 "鄑" 195046 "鄛" 12195 "酉" 63769 "酪" 64196 "醙" 63927 "醴" 12196 "釆" 63977 "里" 12197 "里" 63870 "量" 63754 "金" 12198 "金" 11984 "钅" 63921 "鈴" 195047 "鈸" 64197 "鉶" 195048 "鋗" 195049 "鋘" 195050 "鉼" 63807 "錄" 63899 "鍊" 37806 "鎭" 195051 "鏹" 195052 "鐕" 195053 "𨯺" 11986 "镸" 11987 "长" 12200 "門" 11988 "门" 195054 "開" 195055 "䦕" 63878 "閭" 195056 "閷" 195057 "𨵷" 12201 "阜" 11983 "阝" 11990 "阝" 63942 "阮" 63825 "陋" 64009 "降" 63833 "陵" 63955 "陸" 64198 "陼" 63964 "隆" 63985 "隣" 195058 "䧦" 12202 "隶" 64047 "隷" 38584 "隷" 63928 "隷" 12203 "隹" 195059 "雃" 63978 "離" 64104 "難" 64199 "難" 12204 "雨" 63922 "零" 63817 "雷" 195061 "霣" 195062 "𩅅" 63800 "露" 63923 "靈" 12205 "靑" 11992 "青" 64028 "靖" 64200 "靖" 194588 "𩇟" 12206 "非" 12207 "面" 195063 "𩈚" 12208 "革" 195064 "䩮" 195065 "䩶" 12209 "韋" 11993 "韦" 64201 "韛" 195066 "韠" 12210 "韭" 195067 "𩐊" 12211 "音" 64105 "響" 64202 "響" 12212 "頁" 11994 "页" 195068 "䪲" 64203 "頋" 195070 "頋" 195071 "頋" 63924 "領" 195072 "頩" 195069 "𩒖" 64106 "頻" 64204 "頻" 63952 "類" 12213 "風" 11995 "风" 195073 "𩖶" 12214 "飛" 11996 "飞" 11997 "食" 12215 "食" 11999 "飠" 12000 "饣" 195074 "飢" 64042 "飯" 64043 "飼" 195075 "䬳" 64044 "館" 195076 "餩" 12216 "首" 12217 "香" 195077 "馧" 12218 "馬" 12002 "马" 195078 "駂" 63770 "駱" 195079 "駾" 63879 "驪" 12219 "骨" 195080 "䯎" 12220 "高" 12221 "髟" 195081 "𩬰" 64205 "鬒" 195082 "鬒" 12222 "鬥" 12223 "鬯" 12224 "鬲" 12225 "鬼" 12004 "鬼" 12226 "魚" 12005 "鱼" 63801 "魯" 195083 "鱀" 63986 "鱗" 12227 "鳥" 195084 "鳽" 195085 "䳎" 40515 "鹂" 195087 "鵧" 195086 "䳭" 195088 "𪃎" 64045 "鶴" 195090 "𪄅" 195089 "䳸" 63802 "鷺" 195091 "𪈎" 63776 "鸞" 12228 "鹵" 63808 "鹿" 12229 "鹿" 195092 "𪊑" 63880 "麗" 63987 "麟" 12230 "麥" 12008 "麦" 195093 "麻" 12231 "麻" 194703 "𪎒" 12232 "黃" 12009 "黄" 12233 "黍" 63881 "黎" 195094 "䵖" 12234 "黑" 40658 "黑" 64058 "墨" 195095 "黹" 12235 "黹" 12236 "黽" 195096 "黾" 195097 "鼅" 12237 "鼎" 195098 "鼏" 12238 "鼓" 195099 "鼖" 12239 "鼠" 195100 "鼻" 12240 "鼻" 64216 "齃" 12241 "齊" 12012 "齐" 12242 "齒" 12014 "齿" 195101 "𪘀" 63940 "龍" 12243 "龍" 12016 "龙" 64217 "龎" 63751 "龜" 63752 "龜" 64206 "龜" 12244 "龜" 12019 "龟" 12245 "龠" 3292 "౜" 7656 "᫚" 11758 "᫛" 6887 "᫥" 794 "᫩" 661 "꟎" 42959 "꟎" 840 "𐻺" 2390 "𑭢" 2625 "𑭢" 2391 "𑭣" 2626 "𑭣" 2375 "𑭤" 2631 "𑭤" 20818 "𖿳" 128013 "𜳺" 128067 "𜳼" 127863 "𜺺" 127970 "𜺻" 127795 "𜺼" 127822 "𜺽" 127823 "𜺽" 127826 "𜺾" 127827 "𜺿" 10495 "𜻠" 10677 "𜻰" 8644 "🣐" 8652 "🣑" 9815 "🩕" 9821 "🩗" 128276 "🯺" 24888 "𫜿")))
+
+(provide 'uni-confusable)
+
+;; Local Variables:
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; coding: utf-8-emacs-unix
+;; End:
+
+;;; uni-confusable.el ends here
@@ -0,0 +1,624 @@
+;;; uni-scripts.el --- automatically generated (do not edit)   -*- lexical-binding: t -*-
+;; Generated by the `unidata-gen-charprop' function.
+
+;; This file is part of GNU Emacs.
+
+;;; Commentary:
+
+;; See the admin/unidata/ directory in the Emacs sources.
+
+;;; Code:
+
+(textsec--create-script-table '(
+((adlam)
+ ((125278 . 125279) (125264 . 125273) 125259 (125252 . 125258) (125184 . 125251)))
+((ahom)
+ ((71488 . 71494) 71487 (71484 . 71486) (71482 . 71483) (71472 . 71481) (71463 . 71467) 71462 (71458 . 71461) (71456 . 71457) 71455 71454 71453 (71424 . 71450)))
+((anatolian-hieroglyphs)
+ ((82944 . 83526)))
+((arabic thaana)
+ (65021 65010))
+((arabic hanifi-rohingya)
+ (1748))
+((arabic thaana yezidi)
+ (1641 1640 1639 1638 1637 1636 1635 1634 1633 1632))
+((arabic syriac thaana)
+ (1564))
+((arabic)
+ ((126704 . 126705) (126635 . 126651) (126629 . 126633) (126625 . 126627) (126603 . 126619) (126592 . 126601) 126590 (126585 . 126588) (126580 . 126583) (126572 . 126578) (126567 . 126570) 126564 (126561 . 126562) 126559 126557 126555 126553 126551 126548 (126545 . 126546) (126541 . 126543) 126539 126537 126535 126530 126523 126521 (126516 . 126519) (126505 . 126514) 126503 126500 (126497 . 126498) (126469 . 126495) (126464 . 126467) (69370 . 69375) (69329 . 69336) 69328 (69318 . 69319) 69317 (69314 . 69316) (69216 . 69246) (65142 . 65276) (65136 . 65140) (65022 . 65023) 65020 (65011 . 65019) (65008 . 65009) (64968 . 64975) (64914 . 64967) (64912 . 64913) (64848 . 64911) (64832 . 64847) (64467 . 64829) (64451 . 64466) (64434 . 64450) (64336 . 64433) (2275 . 2303) (2250 . 2273) 2249 (2208 . 2248) (2199 . 2207) (2192 . 2193) (2185 . 2191) 2184 (2160 . 2183) (1872 . 1919) 1791 (1789 . 1790) (1786 . 1788) (1776 . 1785) (1774 . 1775) (1770 . 1773) 1769 (1767 . 1768) (1765 . 1766) (1759 . 1764) 1758 (1750 . 1756) 1749 (1649 . 1747) (1646 . 1647) (1642 . 1645) (1622 . 1631) (1601 . 1610) (1568 . 1599) (1565 . 1566) (1552 . 1562) (1550 . 1551) 1549 1547 (1545 . 1546) (1542 . 1544) (1536 . 1540)))
+((armenian georgian glagolitic)
+ (1417))
+((armenian)
+ ((64275 . 64279) 1423 (1421 . 1422) 1418 (1376 . 1416) (1370 . 1375) 1369 (1329 . 1366)))
+((avestan)
+ ((68409 . 68415) (68352 . 68405)))
+((balinese)
+ ((7037 . 7039) (7028 . 7036) (7019 . 7027) (7009 . 7018) (7002 . 7008) (6992 . 7001) (6990 . 6991) (6981 . 6988) (6979 . 6980) 6978 (6973 . 6977) 6972 6971 (6966 . 6970) 6965 6964 (6917 . 6963) 6916 (6912 . 6915)))
+((bamum)
+ ((92160 . 92728) (42738 . 42743) (42736 . 42737) (42726 . 42735) (42656 . 42725)))
+((bassa-vah)
+ (92917 (92912 . 92916) (92880 . 92909)))
+((batak)
+ ((7164 . 7167) (7154 . 7155) (7151 . 7153) 7150 7149 (7146 . 7148) (7144 . 7145) 7143 7142 (7104 . 7141)))
+((bengali chakma syloti-nagri)
+ (2543 2542 2541 2540 2539 2538 2537 2536 2535 2534))
+((bengali)
+ (2558 2557 2556 2555 2554 (2548 . 2553) (2546 . 2547) (2544 . 2545) (2530 . 2531) (2527 . 2529) (2524 . 2525) 2519 2510 2509 (2507 . 2508) (2503 . 2504) (2497 . 2500) (2494 . 2496) 2493 2492 (2486 . 2489) 2482 (2474 . 2480) (2451 . 2472) (2447 . 2448) (2437 . 2444) (2434 . 2435) 2433 2432))
+((beria-erfe)
+ ((93883 . 93907) (93856 . 93880)))
+((bhaiksuki)
+ ((72794 . 72812) (72784 . 72793) (72769 . 72773) 72768 72767 72766 (72760 . 72765) (72752 . 72758) 72751 (72714 . 72750) (72704 . 72712)))
+((bopomofo)
+ ((12704 . 12735) (12549 . 12591) (746 . 747)))
+((brahmi)
+ (69759 69749 (69747 . 69748) (69745 . 69746) 69744 (69734 . 69743) (69714 . 69733) (69703 . 69709) (69688 . 69702) (69635 . 69687) 69634 69633 69632))
+((braille)
+ ((10240 . 10495)))
+((buginese)
+ ((6686 . 6687) 6683 (6681 . 6682) (6679 . 6680) (6656 . 6678)))
+((buhid)
+ ((5970 . 5971) (5952 . 5969)))
+((canadian-aboriginal)
+ ((72368 . 72383) (6320 . 6389) (5743 . 5759) 5742 5741 (5121 . 5740) 5120))
+((carian)
+ ((66208 . 66256)))
+((caucasian-albanian)
+ (66927 (66864 . 66915)))
+((chakma)
+ (69959 (69957 . 69958) 69956 (69952 . 69955) (69942 . 69951) (69933 . 69940) 69932 (69927 . 69931) (69891 . 69926) (69888 . 69890)))
+((cham)
+ ((43612 . 43615) (43600 . 43609) 43597 43596 (43588 . 43595) 43587 (43584 . 43586) (43573 . 43574) (43571 . 43572) (43569 . 43570) (43567 . 43568) (43561 . 43566) (43520 . 43560)))
+((cherokee)
+ ((43888 . 43967) (5112 . 5117) (5024 . 5109)))
+((chorasmian)
+ ((69573 . 69579) (69552 . 69572)))
+((common arabic coptic)
+ (66299 66298 66297 66296 66295 66294 66293 66292 66291 66290 66289 66288 66287 66286 66285 66284 66283 66282 66281 66280 66279 66278 66277 66276 66275 66274 66273))
+((common cypriot linear-a linear-b)
+ (65843 65842 65841 65840 65839 65838 65837 65836 65835 65834 65833 65832 65831 65830 65829 65828 65827 65826 65825 65824 65823 65822 65821 65820 65819 65818 65817 65816 65815 65814 65813 65812 65811 65810 65809 65808 65807 65806 65805 65804 65803 65802 65801 65800 65799))
+((common cypriot linear-b)
+ (65855 65854 65853 65852 65851 65850 65849 65848 65847 65794))
+((common cypriot cypro-minoan linear-b)
+ (65793 65792))
+((common arabic nko)
+ (64831 64830))
+((common buginese javanese)
+ (43471))
+((common kayah-li latin myanmar)
+ (43310))
+((common devanagari dogra gujarati gurmukhi kaithi khojki khudawadi mahajani modi sharada takri tirhuta)
+ (43064))
+((common devanagari dogra gujarati gurmukhi kaithi khojki khudawadi mahajani modi takri tirhuta)
+ (43065 43063 43062))
+((common devanagari dogra gujarati gurmukhi kaithi kannada khojki khudawadi mahajani modi nandinagari sharada takri tirhuta tulu-tigalari)
+ (43061 43060 43059))
+((common devanagari dogra gujarati gurmukhi kaithi kannada khojki khudawadi mahajani malayalam modi nandinagari sharada takri tirhuta tulu-tigalari)
+ (43058 43057 43056))
+((common han latin)
+ (42759 42758 42757 42756 42755 42754 42753 42752))
+((common han hiragana katakana)
+ (12349 12348))
+((common hiragana katakana)
+ (65439 65438 65392 12540 12448 12444 12443 12341 12340 12339 12338 12337))
+((common bopomofo han hangul hiragana katakana yi)
+ (65381 65380 65379 65378 65377 12539 12315 12314 12313 12312 12311 12310 12309 12308 12305 12304 12303 12302 12301 12300))
+((common bopomofo han hangul hiragana katakana lisu mongolian tibetan yi)
+ (12299 12298))
+((common bopomofo han hangul hiragana katakana mongolian tibetan yi)
+ (12297 12296))
+((common han)
+ (127569 127568 119665 119664 119663 119662 119661 119660 119659 119658 119657 119656 119655 119654 119653 119652 119651 119650 119649 119648 13310 13309 13308 13307 13306 13305 13304 13303 13302 13301 13300 13299 13298 13297 13296 13295 13294 13293 13292 13291 13290 13289 13288 13287 13286 13285 13284 13283 13282 13281 13280 13183 13182 13181 13180 13179 13168 13167 13166 13165 13164 13163 13162 13161 13160 13159 13158 13157 13156 13155 13154 13153 13152 13151 13150 13149 13148 13147 13146 13145 13144 13055 13003 13002 13001 13000 12999 12998 12997 12996 12995 12994 12993 12992 12976 12975 12974 12973 12972 12971 12970 12969 12968 12967 12966 12965 12964 12963 12962 12961 12960 12959 12958 12957 12956 12955 12954 12953 12952 12951 12950 12949 12948 12947 12946 12945 12944 12943 12942 12941 12940 12939 12938 12937 12936 12935 12934 12933 12932 12931 12930 12929 12928 12871 12870 12869 12868 12867 12866 12865 12864 12863 12862 12861 12860 12859 12858 12857 12856 12855 12854 12853 12852 12851 12850 12849 12848 12847 12846 12845 12844 12843 12842 12841 12840 12839 12838 12837 12836 12835 12834 12833 12832 12773 12772 12771 12770 12769 12768 12767 12766 12765 12764 12763 12762 12761 12760 12759 12758 12757 12756 12755 12754 12753 12752 12751 12750 12749 12748 12747 12746 12745 12744 12743 12742 12741 12740 12739 12738 12737 12736 12703 12702 12701 12700 12699 12698 12697 12696 12695 12694 12693 12692 12691 12690 12689 12688 12351 12350 12294))
+((common bopomofo han hangul hiragana katakana)
+ (65094 65093 12343 12336 12319 12318 12317 12316 12307 12291))
+((common bopomofo han hangul hiragana katakana mongolian phags-pa yi)
+ (12290))
+((common bopomofo han hangul hiragana katakana mongolian yi)
+ (12289))
+((common han tangut)
+ (12783 12287 12286 12285 12284 12283 12282 12281 12280 12279 12278 12277 12276 12275 12274 12273 12272))
+((common cyrillic glagolitic)
+ (11843))
+((common adlam arabic old-hungarian)
+ (11841))
+((common duployan)
+ (113827 113826 113825 113824 11836))
+((common avestan carian georgian kaithi lydian old-hungarian samaritan)
+ (11825))
+((common avestan old-turkic)
+ (11824))
+((common coptic latin)
+ (11799))
+((common carian greek meroitic-hieroglyphs old-hungarian)
+ (8285))
+((common carian georgian glagolitic lycian old-hungarian old-turkic)
+ (8282))
+((common adlam arabic)
+ (8271))
+((common latin mongolian phags-pa)
+ (8239))
+((common nandinagari)
+ (7418))
+((common bengali)
+ (7415))
+((common devanagari grantha)
+ (7411))
+((common bengali devanagari grantha kannada malayalam nandinagari oriya sinhala telugu tirhuta tulu-tigalari)
+ (7410))
+((common devanagari)
+ (7409 7408 7407 7406 7404))
+((common devanagari newa)
+ (7403))
+((common bengali devanagari sharada)
+ (7402))
+((common devanagari nandinagari newa)
+ (7401))
+((common bengali devanagari)
+ (7414 7413 7393))
+((common devanagari grantha kannada)
+ (7379))
+((common mongolian phags-pa)
+ (6149 6147 6146))
+((common buhid hanunoo tagalog tagbanwa)
+ (5942 5941))
+((common runic)
+ (5869 5868 5867))
+((common georgian glagolitic latin)
+ (4347))
+((common bengali devanagari dogra grantha gujarati gunjala-gondi gurmukhi gurung-khema kannada khudawadi limbu mahajani malayalam masaram-gondi nandinagari ol-onal oriya sinhala syloti-nagri takri tamil telugu tirhuta)
+ (2405))
+((common bengali devanagari dogra grantha gujarati gunjala-gondi gurmukhi kannada khudawadi mahajani malayalam masaram-gondi nandinagari ol-onal oriya sinhala syloti-nagri takri tamil telugu tirhuta)
+ (2404))
+((common adlam arabic hanifi-rohingya mandaic manichaean old-uyghur psalter-pahlavi sogdian syriac)
+ (1600))
+((common adlam arabic garay hanifi-rohingya nko syriac thaana yezidi)
+ (1567))
+((common arabic garay hanifi-rohingya nko syriac thaana yezidi)
+ (1563 1548))
+((common coptic greek)
+ (884))
+((common latin thai)
+ (727))
+((common latin lisu)
+ (717))
+((common bopomofo latin)
+ (729 715 714 713 711))
+((common bengali cyrillic devanagari latin lisu thai toto)
+ (700))
+((common avestan carian coptic duployan elbasan georgian glagolitic gothic greek gunjala-gondi han latin lydian mahajani old-permic shavian)
+ (183))
+((common)
+ ((917536 . 917631) 917505 130042 (130032 . 130041) (129940 . 130031) (129792 . 129938) (129775 . 129784) (129759 . 129770) (129741 . 129756) 129736 (129678 . 129734) (129664 . 129674) (129648 . 129660) (129632 . 129645) (129280 . 129623) (129232 . 129240) (129216 . 129217) (129200 . 129211) (129168 . 129197) (129120 . 129159) (129104 . 129113) (129040 . 129095) (129024 . 129035) 129008 (128992 . 129003) (128768 . 128985) (128752 . 128764) (128732 . 128748) (128000 . 128728) (127995 . 127999) (127744 . 127994) (127584 . 127589) (127552 . 127560) (127504 . 127547) (127489 . 127490) (127462 . 127487) (127245 . 127405) (127232 . 127244) (127185 . 127221) (127169 . 127183) (127153 . 127167) (127136 . 127150) (127024 . 127123) (126976 . 127019) (126255 . 126269) 126254 (126209 . 126253) (126129 . 126132) 126128 (126125 . 126127) 126124 (126065 . 126123) (120782 . 120831) (120772 . 120779) 120771 (120746 . 120770) 120745 (120714 . 120744) 120713 (120688 . 120712) 120687 (120656 . 120686) 120655 (120630 . 120654) 120629 (120598 . 120628) 120597 (120572 . 120596) 120571 (120540 . 120570) 120539 (120514 . 120538) 120513 (120488 . 120512) (120146 . 120485) (120138 . 120144) 120134 (120128 . 120132) (120123 . 120126) (120094 . 120121) (120086 . 120092) (120077 . 120084) (120071 . 120074) (120005 . 120069) (119997 . 120003) 119995 (119982 . 119993) (119977 . 119980) (119973 . 119974) 119970 (119966 . 119967) (119894 . 119964) (119808 . 119892) (119666 . 119672) (119552 . 119638) (119520 . 119539) (119488 . 119507) (119214 . 119274) (119180 . 119209) (119171 . 119172) (119155 . 119162) (119149 . 119154) (119146 . 119148) (119141 . 119142) (119081 . 119140) (119040 . 119078) (118784 . 119029) (118608 . 118723) 118512 (118496 . 118511) (118458 . 118480) (118016 . 118451) (118010 . 118012) (118000 . 118009) (117760 . 117999) (66000 . 66044) (65936 . 65948) (65532 . 65533) (65529 . 65531) (65517 . 65518) (65513 . 65516) 65512 (65509 . 65510) 65508 65507 65506 (65504 . 65505) 65376 65375 65374 65373 65372 65371 65344 65343 65342 65341 65340 65339 (65311 . 65312) (65308 . 65310) (65306 . 65307) (65296 . 65305) (65294 . 65295) 65293 65292 65291 65290 65289 65288 (65285 . 65287) 65284 (65281 . 65283) 65279 (65130 . 65131) 65129 65128 (65124 . 65126) 65123 65122 (65119 . 65121) 65118 65117 65116 65115 65114 65113 65112 (65108 . 65111) (65104 . 65106) (65101 . 65103) (65097 . 65100) 65096 65095 65092 65091 65090 65089 65088 65087 65086 65085 65084 65083 65082 65081 65080 65079 65078 65077 (65075 . 65076) (65073 . 65074) 65072 65049 65048 65047 (65040 . 65046) (43882 . 43883) 43867 (42889 . 42890) 42888 (42784 . 42785) (42775 . 42783) (42760 . 42774) (19904 . 19967) 13311 (13184 . 13279) (13169 . 13178) (13004 . 13007) (12977 . 12991) 12927 (12881 . 12895) 12880 (12872 . 12879) 12342 12320 12306 12292 12288 11869 11868 11867 11866 11865 11864 11863 11862 11861 (11858 . 11860) (11856 . 11857) (11844 . 11855) 11842 11840 (11837 . 11839) (11834 . 11835) (11826 . 11833) 11823 (11818 . 11822) 11817 11816 11815 11814 11813 11812 11811 11810 11809 11808 (11806 . 11807) 11805 11804 11803 11802 (11800 . 11801) (11790 . 11798) 11789 11788 11787 11786 11785 (11782 . 11784) 11781 11780 11779 11778 (11776 . 11777) (11126 . 11263) (11085 . 11123) (11079 . 11084) (11077 . 11078) (11056 . 11076) (11008 . 11055) (10750 . 11007) 10749 10748 (10716 . 10747) 10715 10714 10713 10712 (10649 . 10711) 10648 10647 10646 10645 10644 10643 10642 10641 10640 10639 10638 10637 10636 10635 10634 10633 10632 10631 10630 10629 10628 10627 (10496 . 10626) (10224 . 10239) 10223 10222 10221 10220 10219 10218 10217 10216 10215 10214 (10183 . 10213) 10182 10181 (10176 . 10180) (10132 . 10175) (10102 . 10131) 10101 10100 10099 10098 10097 10096 10095 10094 10093 10092 10091 10090 10089 10088 (9840 . 10087) 9839 (9728 . 9838) (9720 . 9727) (9666 . 9719) 9665 (9656 . 9664) 9655 (9472 . 9654) (9450 . 9471) (9372 . 9449) (9312 . 9371) (9280 . 9290) (9186 . 9257) (9180 . 9185) (9140 . 9179) (9115 . 9139) (9085 . 9114) 9084 (9003 . 9083) 9002 9001 (8994 . 9000) (8992 . 8993) (8972 . 8991) 8971 8970 8969 8968 (8960 . 8967) (8692 . 8959) (8661 . 8691) 8660 8659 8658 (8656 . 8657) (8654 . 8655) (8623 . 8653) 8622 (8615 . 8621) 8614 (8612 . 8613) 8611 (8609 . 8610) 8608 (8604 . 8607) (8602 . 8603) (8597 . 8601) (8592 . 8596) (8586 . 8587) 8585 (8528 . 8543) 8527 (8524 . 8525) 8523 8522 (8517 . 8521) (8512 . 8516) (8508 . 8511) (8506 . 8507) 8505 (8501 . 8504) (8499 . 8500) (8495 . 8497) 8494 (8492 . 8493) 8489 8488 8487 8485 8484 (8478 . 8483) (8473 . 8477) 8472 (8470 . 8471) 8469 8468 (8458 . 8467) (8456 . 8457) 8455 (8451 . 8454) 8450 (8448 . 8449) (8352 . 8385) 8334 8333 (8330 . 8332) (8320 . 8329) 8318 8317 (8314 . 8316) (8308 . 8313) 8304 (8294 . 8303) (8288 . 8292) 8287 8286 (8283 . 8284) (8277 . 8281) 8276 8275 8274 (8272 . 8273) (8263 . 8270) 8262 8261 8260 (8257 . 8259) (8255 . 8256) (8251 . 8254) 8250 8249 (8240 . 8248) (8234 . 8238) 8233 8232 (8224 . 8231) 8223 8222 8221 (8219 . 8220) 8218 8217 8216 (8214 . 8215) (8208 . 8213) (8206 . 8207) 8203 (8192 . 8202) (4053 . 4056) 3647 2274 1757 1541 903 901 894 (751 . 767) 750 749 748 (741 . 745) (730 . 735) 728 (722 . 726) (718 . 721) 716 712 710 (706 . 709) (701 . 705) (697 . 699) 247 215 191 (188 . 190) 187 185 184 182 181 180 (178 . 179) 177 176 175 174 173 172 171 169 168 167 166 (162 . 165) 161 160 (127 . 159) 126 125 124 123 96 95 94 93 92 91 (63 . 64) (60 . 62) (58 . 59) (48 . 57) (46 . 47) 45 44 43 42 41 40 (37 . 39) 36 (33 . 35) 32 (0 . 31)))
+((coptic)
+ ((11518 . 11519) 11517 (11513 . 11516) (11506 . 11507) (11503 . 11505) (11499 . 11502) (11493 . 11498) (11392 . 11492) (994 . 1007)))
+((cuneiform)
+ ((74880 . 75075) (74864 . 74868) (74752 . 74862) (73728 . 74649)))
+((cypriot)
+ (67647 67644 (67639 . 67640) (67594 . 67637) 67592 (67584 . 67589)))
+((cypro-minoan)
+ ((77809 . 77810) (77712 . 77808)))
+((cyrillic glagolitic)
+ (42607 1159 1156))
+((cyrillic old-permic)
+ (1155))
+((cyrillic)
+ (123023 (122928 . 122989) (65070 . 65071) (42654 . 42655) (42652 . 42653) (42624 . 42651) 42623 42622 (42612 . 42621) 42611 (42608 . 42610) 42606 (42560 . 42605) (11744 . 11775) 7544 7467 (7296 . 7306) (1162 . 1327) (1160 . 1161) 1154 (1024 . 1153)))
+((deseret)
+ ((66560 . 66639)))
+((devanagari tamil)
+ (43251))
+((devanagari bengali tulu-tigalari)
+ (43249))
+((devanagari dogra kaithi mahajani)
+ (2415 2414 2413 2412 2411 2410 2409 2408 2407 2406))
+((devanagari)
+ ((72448 . 72457) 43263 (43261 . 43262) 43260 43259 (43256 . 43258) (43252 . 43255) 43250 (43232 . 43248) (2418 . 2431) 2417 2416 (2402 . 2403) (2392 . 2401) (2389 . 2391) 2384 (2382 . 2383) 2381 (2377 . 2380) (2369 . 2376) (2366 . 2368) 2365 2364 2363 2362 (2308 . 2361) 2307 (2304 . 2306)))
+((dives-akuru)
+ ((72016 . 72025) (72004 . 72006) 72003 72002 72001 72000 71999 71998 71997 (71995 . 71996) (71991 . 71992) (71984 . 71989) (71960 . 71983) (71957 . 71958) (71948 . 71955) 71945 (71936 . 71942)))
+((dogra)
+ (71739 (71737 . 71738) 71736 (71727 . 71735) (71724 . 71726) (71680 . 71723)))
+((duployan)
+ (113823 (113821 . 113822) 113820 (113808 . 113817) (113792 . 113800) (113776 . 113788) (113664 . 113770)))
+((egyptian-hieroglyphs)
+ ((78944 . 82938) (78919 . 78933) (78913 . 78918) 78912 (78896 . 78911) (77824 . 78895)))
+((elbasan)
+ ((66816 . 66855)))
+((elymaic)
+ ((69600 . 69622)))
+((ethiopic)
+ ((124912 . 124926) (124909 . 124910) (124904 . 124907) (124896 . 124902) (43816 . 43822) (43808 . 43814) (43793 . 43798) (43785 . 43790) (43777 . 43782) (11736 . 11742) (11728 . 11734) (11720 . 11726) (11712 . 11718) (11704 . 11710) (11696 . 11702) (11688 . 11694) (11680 . 11686) (11648 . 11670) (5008 . 5017) (4992 . 5007) (4969 . 4988) (4960 . 4968) (4957 . 4959) (4888 . 4954) (4882 . 4885) (4824 . 4880) (4808 . 4822) (4802 . 4805) 4800 (4792 . 4798) (4786 . 4789) (4752 . 4784) (4746 . 4749) (4704 . 4744) (4698 . 4701) 4696 (4688 . 4694) (4682 . 4685) (4608 . 4680)))
+((garay)
+ ((69006 . 69007) (68976 . 68997) 68975 68974 (68969 . 68973) (68944 . 68965) 68943 68942 (68938 . 68941) (68928 . 68937)))
+((georgian)
+ (11565 11559 (11520 . 11557) (7357 . 7359) (7312 . 7354) (4349 . 4351) 4348 (4304 . 4346) 4301 4295 (4256 . 4293)))
+((glagolitic)
+ ((122918 . 122922) (122915 . 122916) (122907 . 122913) (122888 . 122904) (122880 . 122886) (11264 . 11359)))
+((gothic)
+ (66378 (66370 . 66377) 66369 (66352 . 66368)))
+((grantha tamil)
+ (70460 70403 70401))
+((grantha)
+ ((70512 . 70516) (70502 . 70508) (70498 . 70499) (70493 . 70497) 70487 70480 (70475 . 70477) (70471 . 70472) (70465 . 70468) 70464 (70462 . 70463) 70461 (70453 . 70457) (70450 . 70451) (70442 . 70448) (70419 . 70440) (70415 . 70416) (70405 . 70412) 70402 70400))
+((greek coptic)
+ (885))
+((greek)
+ (119365 (119362 . 119364) (119296 . 119361) 65952 (65932 . 65934) (65930 . 65931) (65913 . 65929) (65909 . 65912) (65856 . 65908) 43877 8486 (8189 . 8190) (8182 . 8188) (8178 . 8180) (8173 . 8175) (8160 . 8172) (8157 . 8159) (8150 . 8155) (8144 . 8147) (8141 . 8143) (8134 . 8140) (8130 . 8132) (8127 . 8129) 8126 8125 (8118 . 8124) (8064 . 8116) (8031 . 8061) 8029 8027 8025 (8016 . 8023) (8008 . 8013) (7968 . 8005) (7960 . 7965) (7936 . 7957) 7615 (7526 . 7530) (7517 . 7521) (7462 . 7466) (1015 . 1023) 1014 (1008 . 1013) (931 . 993) (910 . 929) 908 (904 . 906) 902 900 895 (891 . 893) 890 (886 . 887) (880 . 883)))
+((gujarati khojki)
+ (2799 2798 2797 2796 2795 2794 2793 2792 2791 2790))
+((gujarati)
+ ((2810 . 2815) 2809 2801 2800 (2786 . 2787) (2784 . 2785) 2768 2765 (2763 . 2764) 2761 (2759 . 2760) (2753 . 2757) (2750 . 2752) 2749 2748 (2741 . 2745) (2738 . 2739) (2730 . 2736) (2707 . 2728) (2703 . 2705) (2693 . 2701) 2691 (2689 . 2690)))
+((gunjala-gondi)
+ ((73120 . 73129) 73112 73111 73110 73109 (73107 . 73108) (73104 . 73105) (73098 . 73102) (73066 . 73097) (73063 . 73064) (73056 . 73061)))
+((gurmukhi multani)
+ (2671 2670 2669 2668 2667 2666 2665 2664 2663 2662))
+((gurmukhi)
+ (2678 2677 (2674 . 2676) (2672 . 2673) 2654 (2649 . 2652) 2641 (2635 . 2637) (2631 . 2632) (2625 . 2626) (2622 . 2624) 2620 (2616 . 2617) (2613 . 2614) (2610 . 2611) (2602 . 2608) (2579 . 2600) (2575 . 2576) (2565 . 2570) 2563 (2561 . 2562)))
+((gurung-khema)
+ ((90416 . 90425) (90413 . 90415) (90410 . 90412) (90398 . 90409) (90368 . 90397)))
+((han)
+ ((201552 . 210041) (196608 . 201546) (194560 . 195101) (191472 . 192093) (183984 . 191456) (178208 . 183981) (173824 . 178205) (131072 . 173791) (94196 . 94198) (94194 . 94195) (94192 . 94193) 94179 94178 (64112 . 64217) (63744 . 64109) (19968 . 40959) (13312 . 19903) 12347 (12344 . 12346) (12321 . 12329) 12295 12293 (12032 . 12245) (11931 . 12019) (11904 . 11929)))
+((hangul)
+ ((65498 . 65500) (65490 . 65495) (65482 . 65487) (65474 . 65479) (65440 . 65470) (55243 . 55291) (55216 . 55238) (44032 . 55203) (43360 . 43388) (12896 . 12926) (12800 . 12830) (12593 . 12686) (12334 . 12335) (4352 . 4607)))
+((hanifi-rohingya)
+ ((68912 . 68921) (68900 . 68903) (68864 . 68899)))
+((hanunoo)
+ (5940 (5938 . 5939) (5920 . 5937)))
+((hatran)
+ ((67835 . 67839) (67828 . 67829) (67808 . 67826)))
+((hebrew)
+ ((64326 . 64335) (64323 . 64324) (64320 . 64321) 64318 (64312 . 64316) (64298 . 64310) 64297 (64287 . 64296) 64286 64285 (1523 . 1524) (1519 . 1522) (1488 . 1514) 1479 1478 (1476 . 1477) 1475 (1473 . 1474) 1472 1471 1470 (1425 . 1469)))
+((hiragana)
+ (127488 (110928 . 110930) 110898 (110593 . 110879) 12447 (12445 . 12446) (12353 . 12438)))
+((imperial-aramaic)
+ ((67672 . 67679) 67671 (67648 . 67669)))
+((inherited grantha tamil)
+ (70459))
+((inherited arabic coptic)
+ (66272))
+((inherited hiragana katakana)
+ (12442 12441))
+((inherited bopomofo han)
+ (12333 12332 12331 12330))
+((inherited devanagari grantha latin)
+ (8432))
+((inherited syriac)
+ (7674))
+((inherited cyrillic latin syriac)
+ (7672))
+((inherited devanagari grantha)
+ (7417 7416))
+((inherited devanagari grantha kannada tulu-tigalari)
+ (7412))
+((inherited bengali devanagari newa sharada)
+ (7405))
+((inherited devanagari newa tirhuta)
+ (7394))
+((inherited devanagari kannada malayalam oriya tamil telugu)
+ (7386))
+((inherited devanagari sharada)
+ (7392 7389 7388 7385))
+((inherited bengali devanagari newa telugu)
+ (7384))
+((inherited devanagari newa sharada)
+ (7383))
+((inherited bengali devanagari telugu)
+ (7382))
+((inherited bengali devanagari newa telugu tirhuta)
+ (7381))
+((inherited devanagari)
+ (7400 7399 7398 7397 7396 7395 7391 7390 7387 7380 7377))
+((inherited bengali devanagari grantha kannada)
+ (7378 7376))
+((inherited bengali devanagari grantha gujarati gurmukhi kannada latin malayalam newa oriya tamil telugu tirhuta)
+ (2386))
+((inherited bengali devanagari grantha gujarati gurmukhi kannada latin malayalam nandinagari newa oriya sharada tamil telugu tirhuta)
+ (2385))
+((inherited arabic syriac)
+ (1648 1621 1620 1619 1618 1617 1616 1615 1614 1613 1612 1611))
+((inherited cyrillic latin)
+ (1158 1157))
+((inherited latin)
+ (879 878 877 876 875 874 873 872 871 870 869 868 867))
+((inherited caucasian-albanian latin todhri)
+ (862))
+((inherited latin osage)
+ (856))
+((inherited greek)
+ (7617 7616 837 834))
+((inherited caucasian-albanian cherokee gothic latin sunuwar syriac thai)
+ (817))
+((inherited cherokee latin syriac)
+ (816))
+((inherited latin sunuwar syriac)
+ (813))
+((inherited latin syriac)
+ (814 805))
+((inherited cherokee duployan latin syriac)
+ (804))
+((inherited cherokee duployan katakana latin syriac tifinagh)
+ (803))
+((inherited greek latin old-permic todhri)
+ (787))
+((inherited cyrillic latin todhri)
+ (785))
+((inherited)
+ ((917760 . 917999) (119210 . 119213) (119173 . 119179) (119163 . 119170) (119143 . 119145) (118576 . 118598) (118528 . 118573) 66045 (65056 . 65069) (65024 . 65039) (8421 . 8431) (8418 . 8420) 8417 (8413 . 8416) (8400 . 8412) (8204 . 8205) (7675 . 7679) 7673 (7618 . 7671) (6880 . 6891) (6847 . 6877) 6846 (6832 . 6845) (2387 . 2388) (863 . 866) (857 . 861) (838 . 855) (835 . 836) (818 . 833) 815 (806 . 812) (788 . 802) 786 783))
+((inherited ethiopic latin)
+ (782))
+((inherited latin sunuwar)
+ (784 781))
+((inherited cherokee latin tai-le)
+ (780))
+((inherited cherokee cyrillic latin osage)
+ (779))
+((inherited duployan latin syriac)
+ (778))
+((inherited latin tifinagh)
+ (777))
+((inherited armenian cyrillic duployan gothic greek hebrew latin old-permic syriac tai-le tifinagh)
+ (776))
+((inherited coptic duployan hebrew latin old-permic syriac tai-le tifinagh todhri)
+ (775))
+((inherited cyrillic greek latin old-permic tifinagh)
+ (774))
+((inherited coptic elbasan glagolitic gothic katakana latin)
+ (773))
+((inherited caucasian-albanian cherokee coptic cyrillic gothic greek latin osage syriac tifinagh todhri)
+ (772))
+((inherited glagolitic latin sunuwar syriac thai)
+ (771))
+((inherited cherokee cyrillic latin tifinagh)
+ (770))
+((inherited cherokee cyrillic greek latin osage sunuwar tai-le todhri)
+ (769))
+((inherited cherokee coptic cyrillic greek latin old-permic sunuwar tai-le)
+ (768))
+((inscriptional-pahlavi)
+ ((68472 . 68479) (68448 . 68466)))
+((inscriptional-parthian)
+ ((68440 . 68447) (68416 . 68437)))
+((javanese)
+ ((43486 . 43487) (43472 . 43481) (43457 . 43469) (43454 . 43456) (43452 . 43453) (43450 . 43451) (43446 . 43449) (43444 . 43445) 43443 (43396 . 43442) 43395 (43392 . 43394)))
+((kaithi)
+ (69837 69826 (69822 . 69825) 69821 (69819 . 69820) (69817 . 69818) (69815 . 69816) (69811 . 69814) (69808 . 69810) (69763 . 69807) 69762 (69760 . 69761)))
+((kannada nandinagari tulu-tigalari)
+ (3311 3310 3309 3308 3307 3306 3305 3304 3303 3302))
+((kannada)
+ (3315 (3313 . 3314) (3298 . 3299) (3296 . 3297) (3292 . 3294) (3285 . 3286) (3276 . 3277) (3274 . 3275) (3271 . 3272) 3270 (3264 . 3268) 3263 3262 3261 3260 (3253 . 3257) (3242 . 3251) (3218 . 3240) (3214 . 3216) (3205 . 3212) 3204 (3202 . 3203) 3201 3200))
+((katakana)
+ ((110948 . 110951) 110933 (110880 . 110882) 110592 (110589 . 110590) (110581 . 110587) (110576 . 110579) (65393 . 65437) (65382 . 65391) (13056 . 13143) (13008 . 13054) (12784 . 12799) 12543 (12541 . 12542) (12449 . 12538)))
+((kawi)
+ (73562 (73552 . 73561) (73539 . 73551) 73538 73537 73536 (73534 . 73535) (73526 . 73530) (73524 . 73525) (73490 . 73523) (73476 . 73488) 73475 73474 (73472 . 73473)))
+((kayah-li)
+ (43311 (43302 . 43309) (43274 . 43301) (43264 . 43273)))
+((kharoshthi)
+ ((68176 . 68184) (68160 . 68168) 68159 (68152 . 68154) (68121 . 68149) (68117 . 68119) (68112 . 68115) (68108 . 68111) (68101 . 68102) (68097 . 68099) 68096))
+((khitan-small-script)
+ (101631 (101120 . 101589) 94180))
+((khmer)
+ ((6624 . 6655) (6128 . 6137) (6112 . 6121) 6109 6108 6107 (6104 . 6106) 6103 (6100 . 6102) (6089 . 6099) (6087 . 6088) 6086 (6078 . 6085) (6071 . 6077) 6070 (6068 . 6069) (6016 . 6067)))
+((khojki)
+ (70209 (70207 . 70208) 70206 (70200 . 70205) (70198 . 70199) 70197 70196 (70194 . 70195) (70191 . 70193) (70188 . 70190) (70163 . 70187) (70144 . 70161)))
+((khudawadi)
+ ((70384 . 70393) (70371 . 70378) (70368 . 70370) 70367 (70320 . 70366)))
+((kirat-rai)
+ ((93552 . 93561) (93549 . 93551) (93547 . 93548) (93507 . 93546) (93504 . 93506)))
+((lao)
+ ((3804 . 3807) (3792 . 3801) (3784 . 3790) 3782 (3776 . 3780) 3773 (3764 . 3772) (3762 . 3763) 3761 (3751 . 3760) 3749 (3724 . 3747) (3718 . 3722) 3716 (3713 . 3714)))
+((latin)
+ ((122661 . 122666) (122635 . 122654) 122634 (122624 . 122633) (67506 . 67514) (67463 . 67504) (67456 . 67461) (65345 . 65370) (65313 . 65338) (64256 . 64262) 43881 (43878 . 43880) (43872 . 43876) (43868 . 43871) (43824 . 43866) (43003 . 43007) 43002 (43000 . 43001) 42999 (42997 . 42998) (42993 . 42996) (42896 . 42972) 42895 (42891 . 42894) (42865 . 42887) 42864 (42786 . 42863) (11390 . 11391) (11388 . 11389) (11360 . 11387) (8581 . 8584) (8579 . 8580) (8544 . 8578) 8526 8498 (8490 . 8491) (8336 . 8348) 8319 8305 (7680 . 7935) (7579 . 7614) (7545 . 7578) (7531 . 7543) (7522 . 7525) (7468 . 7516) (7424 . 7461) (736 . 740) (688 . 696) (662 . 687) (660 . 661) (452 . 659) (448 . 451) (444 . 447) 443 (248 . 442) (216 . 246) (192 . 214) 186 170 (97 . 122) (65 . 90)))
+((lepcha)
+ ((7245 . 7247) (7232 . 7241) (7227 . 7231) (7222 . 7223) (7220 . 7221) (7212 . 7219) (7204 . 7211) (7168 . 7203)))
+((limbu)
+ ((6470 . 6479) (6468 . 6469) 6464 (6457 . 6459) (6451 . 6456) 6450 (6448 . 6449) (6441 . 6443) (6439 . 6440) (6435 . 6438) (6432 . 6434) (6400 . 6430)))
+((linear-a)
+ ((67424 . 67431) (67392 . 67413) (67072 . 67382)))
+((linear-b)
+ ((65664 . 65786) (65616 . 65629) (65599 . 65613) (65596 . 65597) (65576 . 65594) (65549 . 65574) (65536 . 65547)))
+((lisu)
+ (73648 (42238 . 42239) (42232 . 42237) (42192 . 42231)))
+((lycian)
+ ((66176 . 66204)))
+((lydian)
+ (67903 (67872 . 67897)))
+((mahajani)
+ (70006 (70004 . 70005) 70003 (69968 . 70002)))
+((makasar)
+ ((73463 . 73464) (73461 . 73462) (73459 . 73460) (73440 . 73458)))
+((malayalam)
+ ((3450 . 3455) 3449 (3440 . 3448) (3430 . 3439) (3426 . 3427) (3423 . 3425) (3416 . 3422) 3415 (3412 . 3414) 3407 3406 3405 (3402 . 3404) (3398 . 3400) (3393 . 3396) (3390 . 3392) 3389 (3387 . 3388) (3346 . 3386) (3342 . 3344) (3332 . 3340) (3330 . 3331) (3328 . 3329)))
+((mandaic)
+ (2142 (2137 . 2139) (2112 . 2136)))
+((manichaean old-uyghur)
+ (68338))
+((manichaean)
+ ((68339 . 68342) (68336 . 68337) (68331 . 68335) (68325 . 68326) (68297 . 68324) 68296 (68288 . 68295)))
+((marchen)
+ ((72885 . 72886) 72884 (72882 . 72883) 72881 (72874 . 72880) 72873 (72850 . 72871) (72818 . 72847) (72816 . 72817)))
+((masaram-gondi)
+ ((73040 . 73049) 73031 73030 (73023 . 73029) (73020 . 73021) 73018 (73009 . 73014) (72971 . 73008) (72968 . 72969) (72960 . 72966)))
+((medefaidrin)
+ ((93847 . 93850) (93824 . 93846) (93760 . 93823)))
+((meetei-mayek)
+ ((44016 . 44025) 44013 44012 44011 (44009 . 44010) 44008 (44006 . 44007) 44005 (44003 . 44004) (43968 . 44002) 43766 43765 (43763 . 43764) 43762 (43760 . 43761) (43758 . 43759) (43756 . 43757) 43755 (43744 . 43754)))
+((mende-kikakui)
+ ((125136 . 125142) (125127 . 125135) (124928 . 125124)))
+((meroitic-cursive)
+ ((68050 . 68095) (68032 . 68047) (68030 . 68031) (68028 . 68029) (68000 . 68023)))
+((meroitic-hieroglyphs)
+ ((67968 . 67999)))
+((miao)
+ ((94099 . 94111) (94095 . 94098) (94033 . 94087) 94032 94031 (93952 . 94026)))
+((modi)
+ ((71248 . 71257) 71236 (71233 . 71235) (71231 . 71232) 71230 71229 (71227 . 71228) (71219 . 71226) (71216 . 71218) (71168 . 71215)))
+((mongolian)
+ ((71264 . 71276) 6314 6313 (6279 . 6312) (6277 . 6278) (6272 . 6276) (6212 . 6264) 6211 (6176 . 6210) (6160 . 6169) 6159 6158 (6155 . 6157) (6151 . 6154) 6150 6148 (6144 . 6145)))
+((mro)
+ ((92782 . 92783) (92768 . 92777) (92736 . 92766)))
+((multani)
+ (70313 (70303 . 70312) (70287 . 70301) (70282 . 70285) 70280 (70272 . 70278)))
+((myanmar chakma tai-le)
+ (4169 4168 4167 4166 4165 4164 4163 4162 4161 4160))
+((myanmar)
+ ((71376 . 71395) (43646 . 43647) 43645 43644 43643 43642 (43639 . 43641) (43633 . 43638) 43632 (43616 . 43631) (43514 . 43518) (43504 . 43513) (43495 . 43503) 43494 43493 (43488 . 43492) (4254 . 4255) 4253 (4250 . 4252) (4240 . 4249) 4239 4238 4237 (4231 . 4236) (4229 . 4230) (4227 . 4228) 4226 (4213 . 4225) (4209 . 4212) (4206 . 4208) (4199 . 4205) (4197 . 4198) (4194 . 4196) 4193 (4190 . 4192) (4186 . 4189) (4184 . 4185) (4182 . 4183) (4176 . 4181) (4170 . 4175) 4159 (4157 . 4158) (4155 . 4156) (4153 . 4154) 4152 (4146 . 4151) 4145 (4141 . 4144) (4139 . 4140) (4096 . 4138)))
+((nabataean)
+ ((67751 . 67759) (67712 . 67742)))
+((nag-mundari)
+ ((124144 . 124153) (124140 . 124143) 124139 (124112 . 124138)))
+((nandinagari)
+ (72164 72163 72162 72161 72160 (72156 . 72159) (72154 . 72155) (72148 . 72151) (72145 . 72147) (72106 . 72144) (72096 . 72103)))
+((new-tai-lue)
+ ((6622 . 6623) 6618 (6608 . 6617) (6576 . 6601) (6528 . 6571)))
+((newa)
+ ((70751 . 70753) 70750 70749 (70746 . 70747) (70736 . 70745) (70731 . 70735) (70727 . 70730) 70726 70725 (70722 . 70724) (70720 . 70721) (70712 . 70719) (70709 . 70711) (70656 . 70708)))
+((nko)
+ ((2046 . 2047) 2045 2042 (2039 . 2041) 2038 (2036 . 2037) (2027 . 2035) (1994 . 2026) (1984 . 1993)))
+((nushu)
+ ((110960 . 111355) 94177))
+((nyiakeng-puachue-hmong)
+ (123215 123214 (123200 . 123209) (123191 . 123197) (123184 . 123190) (123136 . 123180)))
+((ogham)
+ (5788 5787 (5761 . 5786) 5760))
+((ol-chiki)
+ ((7294 . 7295) (7288 . 7293) (7258 . 7287) (7248 . 7257)))
+((ol-onal)
+ (124415 (124401 . 124410) 124400 (124398 . 124399) (124368 . 124397)))
+((old-hungarian)
+ ((68858 . 68863) (68800 . 68850) (68736 . 68786)))
+((old-italic)
+ ((66349 . 66351) (66336 . 66339) (66304 . 66335)))
+((old-north-arabian)
+ ((68253 . 68255) (68224 . 68252)))
+((old-permic)
+ ((66422 . 66426) (66384 . 66421)))
+((old-persian)
+ ((66513 . 66517) 66512 (66504 . 66511) (66464 . 66499)))
+((old-sogdian)
+ (69415 (69405 . 69414) (69376 . 69404)))
+((old-south-arabian)
+ (68223 (68221 . 68222) (68192 . 68220)))
+((old-turkic)
+ ((68608 . 68680)))
+((old-uyghur)
+ ((69510 . 69513) (69506 . 69509) (69488 . 69505)))
+((oriya)
+ ((2930 . 2935) 2929 2928 (2918 . 2927) (2914 . 2915) (2911 . 2913) (2908 . 2909) 2903 (2901 . 2902) 2893 (2891 . 2892) (2887 . 2888) (2881 . 2884) 2880 2879 2878 2877 2876 (2869 . 2873) (2866 . 2867) (2858 . 2864) (2835 . 2856) (2831 . 2832) (2821 . 2828) (2818 . 2819) 2817))
+((osage)
+ ((66776 . 66811) (66736 . 66771)))
+((osmanya)
+ ((66720 . 66729) (66688 . 66717)))
+((pahawh-hmong)
+ ((93053 . 93071) (93027 . 93047) (93019 . 93025) (93008 . 93017) 92997 92996 (92992 . 92995) (92988 . 92991) (92983 . 92987) (92976 . 92982) (92928 . 92975)))
+((palmyrene)
+ ((67705 . 67711) (67703 . 67704) (67680 . 67702)))
+((pau-cin-hau)
+ ((72384 . 72440)))
+((phags-pa)
+ ((43124 . 43127) (43072 . 43123)))
+((phoenician)
+ (67871 (67862 . 67867) (67840 . 67861)))
+((psalter-pahlavi)
+ ((68521 . 68527) (68505 . 68508) (68480 . 68497)))
+((rejang)
+ (43359 (43346 . 43347) (43335 . 43345) (43312 . 43334)))
+((runic)
+ ((5873 . 5880) (5870 . 5872) (5792 . 5866)))
+((samaritan)
+ ((2096 . 2110) (2089 . 2093) 2088 (2085 . 2087) 2084 (2075 . 2083) 2074 (2070 . 2073) (2048 . 2069)))
+((saurashtra)
+ ((43216 . 43225) (43214 . 43215) (43204 . 43205) (43188 . 43203) (43138 . 43187) (43136 . 43137)))
+((sharada)
+ (72551 72550 72549 (72546 . 72548) 72545 72544 (70109 . 70111) 70108 70107 70106 (70096 . 70105) 70095 70094 70093 (70089 . 70092) (70085 . 70088) (70081 . 70084) (70079 . 70080) (70070 . 70078) (70067 . 70069) (70019 . 70066) 70018 (70016 . 70017)))
+((shavian)
+ ((66640 . 66687)))
+((siddham)
+ ((71132 . 71133) (71128 . 71131) (71105 . 71127) (71103 . 71104) 71102 (71100 . 71101) (71096 . 71099) (71090 . 71093) (71087 . 71089) (71040 . 71086)))
+((sidetic)
+ ((67904 . 67929)))
+((signwriting)
+ ((121505 . 121519) (121499 . 121503) (121479 . 121483) (121477 . 121478) 121476 (121462 . 121475) 121461 (121453 . 121460) (121403 . 121452) (121399 . 121402) (121344 . 121398) (120832 . 121343)))
+((sinhala)
+ ((70113 . 70132) 3572 (3570 . 3571) (3558 . 3567) (3544 . 3551) 3542 (3538 . 3540) (3535 . 3537) 3530 (3520 . 3526) 3517 (3507 . 3515) (3482 . 3505) (3461 . 3478) (3458 . 3459) 3457))
+((sogdian)
+ ((69461 . 69465) (69457 . 69460) (69446 . 69456) (69424 . 69445)))
+((sora-sompeng)
+ ((69872 . 69881) (69840 . 69864)))
+((soyombo)
+ ((72350 . 72354) 72349 (72346 . 72348) (72344 . 72345) 72343 (72330 . 72342) (72284 . 72329) (72281 . 72283) (72279 . 72280) (72273 . 72278) 72272))
+((sundanese)
+ ((7360 . 7367) (7098 . 7103) (7088 . 7097) (7086 . 7087) (7083 . 7085) 7082 (7080 . 7081) (7078 . 7079) (7074 . 7077) 7073 (7043 . 7072) 7042 (7040 . 7041)))
+((sunuwar)
+ ((72688 . 72697) 72673 (72640 . 72672)))
+((syloti-nagri)
+ (43052 (43048 . 43051) 43047 (43045 . 43046) (43043 . 43044) (43020 . 43042) 43019 (43015 . 43018) 43014 (43011 . 43013) 43010 (43008 . 43009)))
+((syriac)
+ ((2144 . 2154) (1869 . 1871) (1840 . 1866) (1810 . 1839) 1809 1808 1807 (1792 . 1805)))
+((tagalog)
+ (5919 5909 (5906 . 5908) (5888 . 5905)))
+((tagbanwa)
+ ((6002 . 6003) (5998 . 6000) (5984 . 5996)))
+((tai-le)
+ ((6512 . 6516) (6480 . 6509)))
+((tai-tham)
+ ((6824 . 6829) 6823 (6816 . 6822) (6800 . 6809) (6784 . 6793) 6783 (6771 . 6780) (6765 . 6770) (6757 . 6764) (6755 . 6756) 6754 6753 6752 (6744 . 6750) 6743 6742 6741 (6688 . 6740)))
+((tai-viet)
+ ((43742 . 43743) 43741 (43739 . 43740) 43714 43713 43712 (43710 . 43711) (43705 . 43709) (43703 . 43704) (43701 . 43702) (43698 . 43700) 43697 43696 (43648 . 43695)))
+((tai-yo)
+ (124671 124670 124661 (124656 . 124660) (124654 . 124655) (124647 . 124653) 124646 (124644 . 124645) 124643 (124640 . 124642) (124608 . 124638)))
+((takri)
+ ((71360 . 71369) 71353 71352 71351 71350 (71344 . 71349) (71342 . 71343) 71341 71340 71339 (71296 . 71338)))
+((tamil grantha)
+ (73683 73681 73680 3059 3058 3057 3056 3055 3054 3053 3052 3051 3050 3049 3048 3047 3046))
+((tamil)
+ (73727 (73697 . 73713) (73693 . 73696) (73685 . 73692) 73684 73682 (73664 . 73679) 3066 3065 (3060 . 3064) 3031 3024 3021 (3018 . 3020) (3014 . 3016) (3009 . 3010) 3008 (3006 . 3007) (2990 . 3001) (2984 . 2986) (2979 . 2980) (2974 . 2975) 2972 (2969 . 2970) (2962 . 2965) (2958 . 2960) (2949 . 2954) 2947 2946))
+((tangsa)
+ ((92864 . 92873) (92784 . 92862)))
+((tangut)
+ ((101760 . 101874) (101632 . 101662) (94208 . 101119) 94176))
+((telugu)
+ (3199 (3192 . 3198) 3191 (3174 . 3183) (3170 . 3171) (3168 . 3169) (3164 . 3165) (3160 . 3162) (3157 . 3158) (3146 . 3149) (3142 . 3144) (3137 . 3140) (3134 . 3136) 3133 3132 (3114 . 3129) (3090 . 3112) (3086 . 3088) (3077 . 3084) 3076 (3073 . 3075) 3072))
+((thaana)
+ (1969 (1958 . 1968) (1920 . 1957)))
+((thai)
+ ((3674 . 3675) (3664 . 3673) 3663 (3655 . 3662) 3654 (3648 . 3653) (3636 . 3642) (3634 . 3635) 3633 (3585 . 3632)))
+((tibetan)
+ ((4057 . 4058) (4048 . 4052) (4046 . 4047) (4039 . 4044) 4038 (4030 . 4037) (3993 . 4028) (3981 . 3991) (3976 . 3980) (3974 . 3975) 3973 (3968 . 3972) 3967 (3953 . 3966) (3913 . 3948) (3904 . 3911) (3902 . 3903) 3901 3900 3899 3898 3897 3896 3895 3894 3893 3892 (3882 . 3891) (3872 . 3881) (3866 . 3871) (3864 . 3865) (3861 . 3863) 3860 3859 (3844 . 3858) (3841 . 3843) 3840))
+((tifinagh)
+ (11647 11632 11631 (11568 . 11623)))
+((tirhuta)
+ ((70864 . 70873) 70855 70854 (70852 . 70853) (70850 . 70851) 70849 (70847 . 70848) (70843 . 70846) 70842 70841 (70835 . 70840) (70832 . 70834) (70784 . 70831)))
+((todhri)
+ ((67008 . 67059)))
+((tolong-siki)
+ ((73184 . 73193) (73178 . 73179) 73177 (73136 . 73176)))
+((toto)
+ (123566 (123536 . 123565)))
+((tulu-tigalari)
+ ((70625 . 70626) (70615 . 70616) (70612 . 70613) 70611 70610 70609 70608 70607 70606 (70604 . 70605) (70599 . 70602) 70597 70594 (70587 . 70592) (70584 . 70586) 70583 (70544 . 70581) 70542 70539 (70528 . 70537)))
+((ugaritic)
+ (66463 (66432 . 66461)))
+((vai)
+ ((42538 . 42539) (42528 . 42537) (42512 . 42527) (42509 . 42511) 42508 (42240 . 42507)))
+((vithkuqi)
+ ((67003 . 67004) (66995 . 67001) (66979 . 66993) (66967 . 66977) (66964 . 66965) (66956 . 66962) (66940 . 66954) (66928 . 66938)))
+((wancho)
+ (123647 (123632 . 123641) (123628 . 123631) (123584 . 123627)))
+((warang-citi)
+ (71935 (71914 . 71922) (71904 . 71913) (71840 . 71903)))
+((yezidi)
+ ((69296 . 69297) 69293 (69291 . 69292) (69248 . 69289)))
+((yi)
+ ((42128 . 42182) (40982 . 42124) 40981 (40960 . 40980)))
+((zanabazar-square)
+ (72263 (72255 . 72262) (72251 . 72254) 72250 72249 (72243 . 72248) (72203 . 72242) (72193 . 72202) 72192))
+))
+
+(provide 'uni-scripts)
+
+;; Local Variables:
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; coding: utf-8-emacs-unix
+;; End:
+
+;;; uni-scripts.el ends here
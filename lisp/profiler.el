@@ -40,6 +40,16 @@
   "Default sampling interval in nanoseconds."
   :type 'natnum)
 
+(defcustom profiler-sample-wall-clock nil
+  "Non-nil means the CPU profiler samples elapsed time.
+The default, nil, means it samples CPU time, which does not include the
+time Emacs spends waiting for input, for subprocess output, for file
+I/O, or for locks.  When this is non-nil, the profile also shows where
+Emacs waits for those.  Sampling elapsed time requires POSIX timers,
+which some systems lack."
+  :type 'boolean
+  :version "32.1")
+
 
 ;;; Utilities
 
@@ -809,6 +819,7 @@ point."
 MODE can be one of `cpu', `mem', or `cpu+mem'.
 If MODE is `cpu' or `cpu+mem', start the time-based profiler,
    whereby CPU is sampled periodically using the SIGPROF signal.
+   See also `profiler-sample-wall-clock'.
 If MODE is `mem' or `cpu+mem', start profiler that samples CPU
    whenever memory-allocation functions are called -- this is useful
    if SIGPROF is not supported, or is unreliable, or is not sampling
@@ -820,13 +831,15 @@ If MODE is `mem' or `cpu+mem', start profiler that samples CPU
                                     nil t nil nil "cpu")))))
   (cl-ecase mode
     (cpu
-     (profiler-cpu-start profiler-sampling-interval)
+     (profiler-cpu-start profiler-sampling-interval
+                         profiler-sample-wall-clock)
      (message "CPU profiler started"))
     (mem
      (profiler-memory-start)
      (message "Memory profiler started"))
     (cpu+mem
-     (profiler-cpu-start profiler-sampling-interval)
+     (profiler-cpu-start profiler-sampling-interval
+                         profiler-sample-wall-clock)
      (profiler-memory-start)
      (message "CPU and memory profiler started"))))
 
@@ -1684,9 +1684,10 @@ rather than line counts."
                (unless relative (widen))
                (goto-char (point-min))
                (if (eq selective-display t)
-                   (re-search-forward "[\n\C-m]" nil 'end (1- line))
-                 (forward-line (1- line)))
-               (point))))
+                   (progn
+                     (re-search-forward "[\n\C-m]" nil 'end (1- line))
+                     (point))
+                 (line-number-position line)))))
     (when (and (not relative)
                (buffer-narrowed-p)
                widen-automatically
@@ -5911,6 +5911,9 @@ As a general recommendation, try to avoid using `looking-back'
 wherever possible, since it is slow."
   (declare
    (advertised-calling-convention (regexp limit &optional greedy) "25.1"))
+  (when (compiled-regexp-p regexp)
+    ;; The regexp is searched for as part of a larger one.
+    (setq regexp (compiled-regexp-pattern regexp)))
   (let ((start (point))
 	(pos
 	 (save-excursion
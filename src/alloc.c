@@ -321,6 +321,31 @@ static struct gcstat
   byte_ct total_hash_table_bytes;
 } gcstat;
 
+/* Kinds of blocks whose occupancy the most-recent GC recorded.  */
+
+enum block_kind
+  {
+    CONS_BLOCKS, FLOAT_BLOCKS, SYMBOL_BLOCKS, INTERVAL_BLOCKS,
+    STRING_BLOCKS, VECTOR_BLOCKS, BLOCK_KINDS
+  };
+
+/* Number of occupancy classes: blocks are classified by the tenth of
+   their space that is used by live objects, and full blocks have a
+   class of their own.  */
+
+enum { OCCUPANCY_CLASSES = 11 };
+
+/* Occupancy of the blocks of one kind that the most-recent GC kept.
+   Objects are never moved, so a block stays allocated as long as any
+   object in it is live.  */
+
+static struct block_occupancy
+{
+  object_ct blocks;
+  byte_ct reserved_bytes, live_bytes;
+  object_ct classes[OCCUPANCY_CLASSES];
+} block_occupancy[BLOCK_KINDS];
+
 /* Total size of ancillary arrays of all allocated hash-table and obarray
    objects, both dead and alive.  This number is always kept up-to-date.  */
 static ptrdiff_t hash_table_allocated_bytes = 0;
@@ -652,6 +677,14 @@ static_assert (PTRDIFF_MAX <= SIZE_MAX);
       malloc_probe (size);			\
   } while (0)
 
+/* Tell the memory profiler that a Lisp object of kind KIND, taking
+   SIZE bytes, is being allocated.  */
+#define OBJECT_PROBE(kind, size)		\
+  do {						\
+    if (profiler_memory_running)		\
+      object_probe (kind, size);		\
+  } while (0)
+
 /* Like malloc but check for no memory, and profile allocations.  */
 
 void *
@@ -933,7 +966,6 @@ lisp_malloc (ptrdiff_t nbytes, bool clearit, enum mem_type type)
 
   if (!val)
     memory_full (nbytes);
-  MALLOC_PROBE (nbytes);
   return val;
 }
 
@@ -1173,8 +1205,6 @@ lisp_align_malloc (ptrdiff_t nbytes, enum mem_type type)
     mem_insert (val, (char *) val + nbytes, type);
 #endif
 
-  MALLOC_PROBE (nbytes);
-
   eassert (0 == ((uintptr_t) val) % BLOCK_ALIGN);
   return val;
 }
@@ -1309,6 +1339,7 @@ make_interval (void)
     }
 
   tally_consing (sizeof (struct interval));
+  OBJECT_PROBE (Qintervals, sizeof (struct interval));
   intervals_consed++;
   RESET_INTERVAL (val);
   val->gcmarkbit = 0;
@@ -1725,6 +1756,7 @@ allocate_string (void)
 
   ++strings_consed;
   tally_consing (sizeof *s);
+  OBJECT_PROBE (Qstrings, sizeof *s);
 
 #ifdef GC_CHECK_STRING_BYTES
   if (!noninteractive)
@@ -1842,11 +1874,26 @@ allocate_string_data (struct Lisp_String *s,
 #endif
 
   tally_consing (needed);
+  OBJECT_PROBE (Qstrings, needed);
 }
 
 
 /* Sweep and compact strings.  */
 
+/* Record that the most-recent GC kept a block of kind KIND, of which
+   LIVE_BYTES out of RESERVED_BYTES are used by live objects.  */
+
+static void
+record_block_occupancy (enum block_kind kind, byte_ct live_bytes,
+			byte_ct reserved_bytes)
+{
+  struct block_occupancy *occ = &block_occupancy[kind];
+  occ->blocks++;
+  occ->live_bytes += live_bytes;
+  occ->reserved_bytes += reserved_bytes;
+  occ->classes[live_bytes * (OCCUPANCY_CLASSES - 1) / reserved_bytes]++;
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_strings (void)
@@ -1938,6 +1985,10 @@ sweep_strings (void)
       else
 	{
 	  gcstat.total_free_strings += nfree;
+	  record_block_occupancy (STRING_BLOCKS,
+				  ((STRING_BLOCK_SIZE - nfree)
+				   * sizeof (struct Lisp_String)),
+				  sizeof b->strings);
 	  b->next = live_blocks;
 	  live_blocks = b;
 	}
@@ -2443,10 +2494,6 @@ pin_string (Lisp_Object string)
   ((block)->gcmarkbits[(n) / BITS_PER_BITS_WORD]	\
    |= (bits_word) 1 << ((n) % BITS_PER_BITS_WORD))
 
-#define UNSETMARKBIT(block,n)				\
-  ((block)->gcmarkbits[(n) / BITS_PER_BITS_WORD]	\
-   &= ~((bits_word) 1 << ((n) % BITS_PER_BITS_WORD)))
-
 #define FLOAT_BLOCK(fptr) \
   (eassert (!pdumper_object_p (fptr)),                                  \
    ((struct float_block *) (((uintptr_t) (fptr)) & ~(BLOCK_ALIGN - 1))))
@@ -2468,9 +2515,6 @@ struct float_block
 #define XFLOAT_MARK(fptr) \
   SETMARKBIT (FLOAT_BLOCK (fptr), FLOAT_INDEX (fptr))
 
-#define XFLOAT_UNMARK(fptr) \
-  UNSETMARKBIT (FLOAT_BLOCK (fptr), FLOAT_INDEX (fptr))
-
 #if GC_ASAN_POISON_OBJECTS
 # define ASAN_POISON_FLOAT_BLOCK(fblk)         \
   __asan_poison_memory_region ((fblk)->floats, \
@@ -2501,6 +2545,13 @@ static int float_block_index = FLOAT_BLOCK_SIZE;
 
 static struct Lisp_Float *float_free_list;
 
+/* First float_block that may still need to be swept after the last
+   GC, or NULL if all have been swept.  See sweep_floats.  */
+
+static struct float_block *float_sweep_next;
+
+static void sweep_floats_lazily (void);
+
 /* Return a new float object with value FLOAT_VALUE.  */
 
 Lisp_Object
@@ -2508,6 +2559,9 @@ make_float (double float_value)
 {
   register Lisp_Object val;
 
+  if (!float_free_list && float_sweep_next)
+    sweep_floats_lazily ();
+
   if (float_free_list)
     {
       XSETFLOAT (val, float_free_list);
@@ -2534,6 +2588,7 @@ make_float (double float_value)
   XFLOAT_INIT (val, float_value);
   eassert (!XFLOAT_MARKED_P (XFLOAT (val)));
   tally_consing (sizeof (struct Lisp_Float));
+  OBJECT_PROBE (Qfloats, sizeof (struct Lisp_Float));
   floats_consed++;
   return val;
 }
@@ -2576,9 +2631,6 @@ struct cons_block
 #define XMARK_CONS(fptr) \
   SETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
 
-#define XUNMARK_CONS(fptr) \
-  UNSETMARKBIT (CONS_BLOCK (fptr), CONS_INDEX (fptr))
-
 /* Minimum number of bytes of consing since GC before next GC,
    when memory is full.  */
 
@@ -2596,6 +2648,13 @@ static int cons_block_index = CONS_BLOCK_SIZE;
 
 static struct Lisp_Cons *cons_free_list;
 
+/* First cons_block that may still need to be swept after the last
+   GC, or NULL if all have been swept.  See sweep_conses.  */
+
+static struct cons_block *cons_sweep_next;
+
+static void sweep_conses_lazily (void);
+
 #if GC_ASAN_POISON_OBJECTS
 # define ASAN_POISON_CONS_BLOCK(b) \
   __asan_poison_memory_region ((b)->conses, sizeof ((b)->conses))
@@ -2628,6 +2687,9 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 {
   register Lisp_Object val;
 
+  if (!cons_free_list && cons_sweep_next)
+    sweep_conses_lazily ();
+
   if (cons_free_list)
     {
       ASAN_UNPOISON_CONS (cons_free_list);
@@ -2653,8 +2715,11 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   XSETCAR (val, car);
   XSETCDR (val, cdr);
-  eassert (!XCONS_MARKED_P (XCONS (val)));
+  /* A cons given to free_cons keeps its mark bit until its block is
+     swept.  */
+  eassert (!XCONS_MARKED_P (XCONS (val)) || cons_sweep_next);
   consing_until_gc -= sizeof (struct Lisp_Cons);
+  OBJECT_PROBE (Qconses, sizeof (struct Lisp_Cons));
   cons_cells_consed++;
   return val;
 }
@@ -2938,7 +3003,8 @@ setup_on_free_list (struct Lisp_Vector *v, ptrdiff_t nbytes)
 static struct vector_block *
 allocate_vector_block (void)
 {
-  struct vector_block *block = xmalloc (sizeof *block);
+  struct vector_block *block
+    = lisp_malloc (sizeof *block, false, MEM_TYPE_NON_LISP);
 
 #ifndef GC_MALLOC_CHECK
   mem_insert (block->data, block->data + VECTOR_BLOCK_BYTES,
@@ -3178,6 +3244,9 @@ cleanup_vector (struct Lisp_Vector *vector)
       treesit_delete_query (PSEUDOVEC_STRUCT (vector, Lisp_TS_Query));
 #endif
       break;
+    case PVEC_COMPILED_REGEXP:
+      free_compiled_regexp (PSEUDOVEC_STRUCT (vector, Lisp_Compiled_Regexp));
+      break;
     case PVEC_MODULE_FUNCTION:
 #ifdef HAVE_MODULES
       {
@@ -3280,6 +3349,7 @@ sweep_vectors (void)
   for (block = vector_blocks; block; block = *bprev)
     {
       bool free_this_block = false;
+      byte_ct live_bytes = 0;
 
       for (vector = (struct Lisp_Vector *) block->data;
 	   VECTOR_IN_BLOCK (vector, block); vector = next)
@@ -3291,6 +3361,7 @@ sweep_vectors (void)
 	      gcstat.total_vectors++;
 	      ptrdiff_t nbytes = vector_nbytes (vector);
 	      gcstat.total_vector_slots += nbytes / word_size;
+	      live_bytes += nbytes;
 	      next = ADVANCE (vector, nbytes);
 	    }
 	  else
@@ -3334,7 +3405,11 @@ sweep_vectors (void)
 	  xfree (block);
 	}
       else
-	bprev = &block->next;
+	{
+	  record_block_occupancy (VECTOR_BLOCKS, live_bytes,
+				  sizeof block->data);
+	  bprev = &block->next;
+	}
     }
 
   /* Sweep large vectors.  */
@@ -3371,12 +3446,32 @@ sweep_vectors (void)
 	 / word_size), \
 	MOST_POSITIVE_FIXNUM))
 
+/* Return the symbol naming objects of type TAG in memory profiles.  */
+
+static Lisp_Object
+vectorlike_kind (enum pvec_type tag)
+{
+  switch (tag)
+    {
+    case PVEC_NORMAL_VECTOR: return Qvectors;
+    case PVEC_BIGNUM: return Qbignums;
+    case PVEC_MARKER: return Qmarkers;
+    case PVEC_OVERLAY: return Qoverlays;
+    case PVEC_BUFFER: return Qbuffers;
+    case PVEC_HASH_TABLE: return Qhash_tables;
+    case PVEC_CLOSURE: return Qclosures;
+    case PVEC_RECORD: return Qrecords;
+    default: return Qpseudovectors;
+    }
+}
+
 /* Value is a pointer to a newly allocated Lisp_Vector structure
    with room for LEN Lisp_Objects.  LEN must be positive and
-   at most VECTOR_ELTS_MAX.  */
+   at most VECTOR_ELTS_MAX.  TAG is the type of the object, which
+   the caller is responsible for storing in its header.  */
 
 static struct Lisp_Vector *
-allocate_vectorlike (ptrdiff_t len, bool clearit)
+allocate_vectorlike (ptrdiff_t len, bool clearit, enum pvec_type tag)
 {
   eassert (0 < len && len <= VECTOR_ELTS_MAX);
   ptrdiff_t nbytes = header_size + len * word_size;
@@ -3408,6 +3503,7 @@ allocate_vectorlike (ptrdiff_t len, bool clearit)
 #endif
 
   tally_consing (nbytes);
+  OBJECT_PROBE (vectorlike_kind (tag), nbytes);
   vector_cells_consed += len;
 
   return p;
@@ -3424,7 +3520,8 @@ allocate_clear_vector (ptrdiff_t len, bool clearit)
     return XVECTOR (zero_vector);
   if (VECTOR_ELTS_MAX < len)
     memory_full_up ();
-  struct Lisp_Vector *v = allocate_vectorlike (len, clearit);
+  struct Lisp_Vector *v
+    = allocate_vectorlike (len, clearit, PVEC_NORMAL_VECTOR);
   v->header.size = len;
   return v;
 }
@@ -3461,7 +3558,7 @@ allocate_pseudovector (int memlen, int lisplen,
   eassert (lisplen <= size_max);
   eassert (memlen <= size_max + rest_max);
 
-  struct Lisp_Vector *v = allocate_vectorlike (memlen, false);
+  struct Lisp_Vector *v = allocate_vectorlike (memlen, false, tag);
   /* Only the first LISPLEN slots will be traced normally by the GC.  */
   memclear (v->contents, zerolen * word_size);
   XSETPVECTYPESIZE (v, tag, lisplen, memlen - lisplen);
@@ -3489,7 +3586,7 @@ allocate_record (EMACS_INT count)
   if (count > PSEUDOVECTOR_SIZE_MASK)
     error ("Attempt to allocate a record of %"pI"d slots; max is %d",
 	   count, PSEUDOVECTOR_SIZE_MASK);
-  struct Lisp_Vector *p = allocate_vectorlike (count, false);
+  struct Lisp_Vector *p = allocate_vectorlike (count, false, PVEC_RECORD);
   p->header.size = count;
   XSETPVECTYPE (p, PVEC_RECORD);
   return p;
@@ -3623,7 +3720,7 @@ usage: (make-closure PROTOTYPE &rest CLOSURE-VARS) */)
 
   /* Return a copy of the prototype function with the new constant vector. */
   ptrdiff_t protosize = PVSIZE (protofun);
-  struct Lisp_Vector *v = allocate_vectorlike (protosize, false);
+  struct Lisp_Vector *v = allocate_vectorlike (protosize, false, PVEC_CLOSURE);
   v->header = XVECTOR (protofun)->header;
   memcpy (v->contents, XVECTOR (protofun)->contents, protosize * word_size);
   v->contents[CLOSURE_CONSTANTS] = constvec;
@@ -3732,6 +3829,7 @@ Its value is void, and its function definition and property list are nil.  */)
 
   init_symbol (val, name);
   tally_consing (sizeof (struct Lisp_Symbol));
+  OBJECT_PROBE (Qsymbols, sizeof (struct Lisp_Symbol));
   symbols_consed++;
   return val;
 }
@@ -3786,9 +3884,10 @@ DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
   struct Lisp_Marker *p = ALLOCATE_PLAIN_PSEUDOVECTOR (struct Lisp_Marker,
 						       PVEC_MARKER);
   p->buffer = 0;
-  p->bytepos = 0;
-  p->charpos = 0;
+  p->rel_bytepos = 0;
+  p->rel_charpos = 0;
   p->next = NULL;
+  p->parent = p->left = p->right = NULL;
   p->insertion_type = 0;
   p->need_adjustment = 0;
   return make_lisp_ptr (p, Lisp_Vectorlike);
@@ -3808,13 +3907,10 @@ build_marker (struct buffer *buf, ptrdiff_t charpos, ptrdiff_t bytepos)
 
   struct Lisp_Marker *m = ALLOCATE_PLAIN_PSEUDOVECTOR (struct Lisp_Marker,
 						       PVEC_MARKER);
-  m->buffer = buf;
-  m->charpos = charpos;
-  m->bytepos = bytepos;
+  m->buffer = NULL;
   m->insertion_type = 0;
   m->need_adjustment = 0;
-  m->next = BUF_MARKERS (buf);
-  BUF_MARKERS (buf) = m;
+  attach_marker (m, buf, charpos, bytepos);
   return make_lisp_ptr (m, Lisp_Vectorlike);
 }
 
@@ -5808,8 +5904,100 @@ maybe_garbage_collect (void)
     garbage_collect ();
 }
 
+/* Collect garbage if more than 1/FACTORth of the allocation that
+   triggers an automatic collection has taken place since the last
+   one.  This lets callers collect at a convenient time, e.g. while
+   Emacs is idle, instead of in the middle of a command.  Return true
+   if a collection was done.  */
+bool
+maybe_garbage_collect_eagerly (EMACS_INT factor)
+{
+  EMACS_INT since_gc = gc_threshold - consing_until_gc;
+  if (factor >= 1 && since_gc > gc_threshold / factor)
+    {
+      garbage_collect ();
+      return true;
+    }
+  return false;
+}
+
 static inline bool mark_stack_empty_p (void);
 
+/* Return the number of bytes of objects of SIZE bytes each that a GC
+   freed, given that LIVE_BEFORE of them were alive after the previous
+   GC, CONSED more were allocated since then, and LIVE_AFTER are alive
+   now.  */
+
+static EMACS_INT
+freed_bytes (object_ct live_before, EMACS_INT consed, object_ct live_after,
+	     ptrdiff_t size)
+{
+  EMACS_INT freed;
+  if (ckd_add (&freed, live_before, consed)
+      || ckd_sub (&freed, freed, live_after)
+      || ckd_mul (&freed, max (freed, 0), size))
+    return EMACS_INT_MAX;
+  return freed;
+}
+
+/* The allocation counters as of the end of the previous GC, or of
+   startup.  */
+static struct
+{
+  EMACS_INT conses, floats, strings, string_chars, vector_cells, symbols;
+} consed_at_gc;
+
+static void
+remember_consed_at_gc (void)
+{
+  consed_at_gc.conses = cons_cells_consed;
+  consed_at_gc.floats = floats_consed;
+  consed_at_gc.strings = strings_consed;
+  consed_at_gc.string_chars = string_chars_consed;
+  consed_at_gc.vector_cells = vector_cells_consed;
+  consed_at_gc.symbols = symbols_consed;
+}
+
+/* Record the end of a GC in the event log, with an estimate of how many
+   bytes of each kind of object it freed.  OLD is the value gcstat had
+   before the GC.  */
+
+static void
+record_gc_end_event (struct gcstat const *old)
+{
+  if (profiler_record_events)
+    {
+      EMACS_INT string_bytes
+	= freed_bytes (old->total_string_bytes,
+		       string_chars_consed - consed_at_gc.string_chars,
+		       gcstat.total_string_bytes, 1);
+      if (ckd_add (&string_bytes, string_bytes,
+		   freed_bytes (old->total_strings,
+				strings_consed - consed_at_gc.strings,
+				gcstat.total_strings,
+				sizeof (struct Lisp_String))))
+	string_bytes = EMACS_INT_MAX;
+      EMACS_INT args[] = {
+	freed_bytes (old->total_conses,
+		     cons_cells_consed - consed_at_gc.conses,
+		     gcstat.total_conses, sizeof (struct Lisp_Cons)),
+	freed_bytes (old->total_floats,
+		     floats_consed - consed_at_gc.floats,
+		     gcstat.total_floats, sizeof (struct Lisp_Float)),
+	string_bytes,
+	freed_bytes (old->total_vector_slots,
+		     vector_cells_consed - consed_at_gc.vector_cells,
+		     gcstat.total_vector_slots, word_size),
+	freed_bytes (old->total_symbols,
+		     symbols_consed - consed_at_gc.symbols,
+		     gcstat.total_symbols, sizeof (struct Lisp_Symbol)),
+      };
+      record_trace_event (TRACE_GC, false, args);
+    }
+
+  remember_consed_at_gc ();
+}
+
 /* Subroutine of Fgarbage_collect that does most of the work.  */
 void
 garbage_collect (void)
@@ -5818,7 +6006,7 @@ garbage_collect (void)
   char stack_top_variable;
   bool message_p;
   specpdl_ref count = SPECPDL_INDEX ();
-  struct timespec start;
+  struct timespec start, sweep_start, sweep_end;
 
   eassert (weak_hash_tables == NULL);
 
@@ -5840,6 +6028,9 @@ garbage_collect (void)
 			: (byte_ct) -1);
 
   start = current_timespec ();
+  if (profiler_record_events)
+    record_trace_event (TRACE_GC, true, NULL);
+  struct gcstat old_gcstat = gcstat;
 
   /* In case user calls debug_print during GC,
      don't let that cause a recursive GC.  */
@@ -5891,6 +6082,10 @@ garbage_collect (void)
 
   shrink_regexp_cache ();
 
+  /* Unmark what the last collection left to be swept lazily, and put
+     its dead conses out of reach of conservative stack marking.  */
+  finish_lazy_sweep ();
+
   gc_in_progress = 1;
 
   /* Mark all the special slots that serve as the roots of accessibility.  */
@@ -5903,6 +6098,7 @@ garbage_collect (void)
   mark_kboards ();
   mark_threads ();
   mark_composite ();
+  mark_regexp_cache ();
   mark_profiler ();
 #ifdef HAVE_PGTK
   mark_pgtkterm ();
@@ -5969,7 +6165,9 @@ garbage_collect (void)
 
   eassert (mark_stack_empty_p ());
 
+  sweep_start = current_timespec ();
   gc_sweep ();
+  sweep_end = current_timespec ();
 
   unmark_main_thread ();
 
@@ -6001,16 +6199,36 @@ garbage_collect (void)
 #endif
 
   /* Accumulate statistics.  */
+  struct timespec elapsed = timespec_sub (current_timespec (), start);
   if (FLOATP (Vgc_elapsed))
     {
       static struct timespec gc_elapsed;
-      gc_elapsed = timespec_add (gc_elapsed,
-				 timespec_sub (current_timespec (), start));
+      gc_elapsed = timespec_add (gc_elapsed, elapsed);
       Vgc_elapsed = make_float (timespectod (gc_elapsed));
     }
+  if (FLOATP (Vgc_mark_elapsed))
+    {
+      static struct timespec gc_mark_elapsed;
+      gc_mark_elapsed = timespec_add (gc_mark_elapsed,
+				      timespec_sub (sweep_start, start));
+      Vgc_mark_elapsed = make_float (timespectod (gc_mark_elapsed));
+    }
+  if (FLOATP (Vgc_sweep_elapsed))
+    {
+      static struct timespec gc_sweep_elapsed;
+      gc_sweep_elapsed = timespec_add (gc_sweep_elapsed,
+				       timespec_sub (sweep_end, sweep_start));
+      Vgc_sweep_elapsed = make_float (timespectod (gc_sweep_elapsed));
+    }
+  Vgc_last_elapsed = make_float (timespectod (elapsed));
+  if (FLOATP (Vgc_max_elapsed)
+      && XFLOAT_DATA (Vgc_max_elapsed) < XFLOAT_DATA (Vgc_last_elapsed))
+    Vgc_max_elapsed = Vgc_last_elapsed;
 
   gcs_done++;
 
+  record_gc_end_event (&old_gcstat);
+
   /* Collect profiling data.  */
   if (tot_before != (byte_ct) -1)
     {
@@ -6107,6 +6325,51 @@ Each entry has the form (NAME SIZE USED FREE), where:
   return CALLMANY (Flist, total);
 }
 
+DEFUN ("memory-fragmentation-report", Fmemory_fragmentation_report,
+       Smemory_fragmentation_report, 0, 0, 0,
+       doc: /* Return a list describing how full the allocation blocks are.
+Small Lisp objects are allocated in blocks of fixed size, and a block
+can only be returned to the system once all the objects in it are dead.
+This function reports how much of the space reserved in such blocks
+was used by live objects at the end of the most recent garbage
+collection.  It is intended to tell how fragmented the heap is.
+
+Each entry has the form (NAME BLOCKS RESERVED LIVE OCCUPANCY), where:
+- NAME is a symbol describing the kind of objects stored in the blocks,
+  as in the value of `garbage-collect',
+- BLOCKS is the number of blocks kept,
+- RESERVED is the number of bytes in those blocks available for objects,
+- LIVE is the number of those bytes used by live objects,
+- OCCUPANCY is a vector of 11 elements, whose Nth element is the number
+  of blocks in which between N and N+1 tenths of the space is used,
+  except that the last element counts the blocks that are full.
+
+Vectors larger than half a vector block, and the contents of strings,
+are allocated separately and are not included.  */)
+  (void)
+{
+  Lisp_Object const names[BLOCK_KINDS] =
+    {
+      [CONS_BLOCKS] = Qconses, [FLOAT_BLOCKS] = Qfloats,
+      [SYMBOL_BLOCKS] = Qsymbols, [INTERVAL_BLOCKS] = Qintervals,
+      [STRING_BLOCKS] = Qstrings, [VECTOR_BLOCKS] = Qvectors,
+    };
+  Lisp_Object report = Qnil;
+
+  for (int kind = BLOCK_KINDS - 1; kind >= 0; kind--)
+    {
+      struct block_occupancy occ = block_occupancy[kind];
+      Lisp_Object classes = make_nil_vector (OCCUPANCY_CLASSES);
+      for (int i = 0; i < OCCUPANCY_CLASSES; i++)
+	ASET (classes, i, make_int (occ.classes[i]));
+      report = Fcons (list5 (names[kind], make_int (occ.blocks),
+			     make_int (occ.reserved_bytes),
+			     make_int (occ.live_bytes), classes),
+		      report);
+    }
+  return report;
+}
+
 DEFUN ("garbage-collect-maybe", Fgarbage_collect_maybe,
 Sgarbage_collect_maybe, 1, 1, 0,
        doc: /* Call `garbage-collect' if enough allocation happened.
@@ -6119,16 +6382,7 @@ Returns non-nil if GC happened, and nil otherwise.  */)
   (Lisp_Object factor)
 {
   CHECK_FIXNAT (factor);
-  EMACS_INT fact = XFIXNAT (factor);
-
-  EMACS_INT since_gc = gc_threshold - consing_until_gc;
-  if (fact >= 1 && since_gc > gc_threshold / fact)
-    {
-      garbage_collect ();
-      return Qt;
-    }
-  else
-    return Qnil;
+  return maybe_garbage_collect_eagerly (XFIXNAT (factor)) ? Qt : Qnil;
 }
 
 /* Mark Lisp objects in glyph matrix MATRIX.  Currently the
@@ -6845,6 +7099,88 @@ survives_gc_p (Lisp_Object obj)
 
 
 
+/* Conses and floats are swept lazily.  gc_sweep only counts the
+   survivors of each block from its mark bits, releases the blocks in
+   which nothing survived, and sweeps the blocks in which everything
+   or nothing survived; the cells of the remaining blocks are put on
+   the free lists by Fcons and make_float when their free lists run
+   dry, or by finish_lazy_sweep when Emacs is idle or before the next
+   collection starts marking.  Blocks still waiting to be swept are
+   recognized by their nonzero mark bits; they are all found from
+   cons_sweep_next and float_sweep_next on in the block chains, since
+   new blocks are added at the front.  */
+
+/* Return the number of objects marked in a block whose mark bits are
+   the ILIM words in GCMARKBITS.  */
+
+static int
+block_marked_count (bits_word const *gcmarkbits, int ilim)
+{
+  int count = 0;
+  for (int i = 0; i < ilim; i++)
+    count += stdc_count_ones (gcmarkbits[i]);
+  return count;
+}
+
+/* Return true if none of the ILIM words of mark bits in GCMARKBITS
+   has a bit set, i.e., no object in the block survived marking.  */
+
+static bool
+block_unmarked_p (bits_word const *gcmarkbits, int ilim)
+{
+  for (int i = 0; i < ilim; i++)
+    if (gcmarkbits[i])
+      return false;
+  return true;
+}
+
+/* Put the unmarked conses among the first LIM ones of CBLK on the
+   free list, and unmark the others.  */
+
+static void
+sweep_cons_block (struct cons_block *cblk, int lim)
+{
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      /* Fast path - all cons cells for this int are marked.  */
+      if (cblk->gcmarkbits[i] != BITS_WORD_MAX)
+	{
+	  int start = i * BITS_PER_BITS_WORD;
+	  int stop = start + min (lim - start, BITS_PER_BITS_WORD);
+	  for (int pos = start; pos < stop; pos++)
+	    if (!GETMARKBIT (cblk, pos))
+	      {
+		ASAN_UNPOISON_CONS (&cblk->conses[pos]);
+		cblk->conses[pos].u.s.u.chain = cons_free_list;
+		cons_free_list = &cblk->conses[pos];
+		cons_free_list->u.s.car = dead_object ();
+		ASAN_POISON_CONS (&cblk->conses[pos]);
+	      }
+	}
+      cblk->gcmarkbits[i] = 0;
+    }
+}
+
+/* Sweep cons blocks left over by the last collection until there is
+   a free cons or no such block remains.  */
+
+static void
+sweep_conses_lazily (void)
+{
+  enum { ilim = (CONS_BLOCK_SIZE + BITS_PER_BITS_WORD - 1)
+		/ BITS_PER_BITS_WORD };
+  while (!cons_free_list && cons_sweep_next)
+    {
+      struct cons_block *cblk = cons_sweep_next;
+      cons_sweep_next = cblk->next;
+      if (!block_unmarked_p (cblk->gcmarkbits, ilim))
+	sweep_cons_block (cblk, CONS_BLOCK_SIZE);
+    }
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_conses (void)
@@ -6857,74 +7193,88 @@ sweep_conses (void)
 
   for (struct cons_block *cblk; (cblk = *cprev); )
     {
-      int i = 0;
-      int this_free = 0;
       int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      int this_used = block_marked_count (cblk->gcmarkbits, ilim);
+      int this_free = lim - this_used;
 
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
-
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
-
-              for (pos = start; pos < stop; pos++)
-                {
-		  struct Lisp_Cons *acons = &cblk->conses[pos];
-		  if (!XCONS_MARKED_P (acons))
-                    {
-		      ASAN_UNPOISON_CONS (&cblk->conses[pos]);
-                      this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->u.s.car = dead_object ();
-		      ASAN_POISON_CONS (&cblk->conses[pos]);
-		    }
-                  else
-                    {
-                      num_used++;
-		      XUNMARK_CONS (acons);
-                    }
-                }
-            }
-        }
-
-      lim = CONS_BLOCK_SIZE;
       /* If this block contains only free conses and we have already
          seen more than two blocks worth of free conses then deallocate
          this block.  */
       if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
         {
           *cprev = cblk->next;
-          /* Unhook from the free list.  */
 	  ASAN_UNPOISON_CONS (&cblk->conses[0]);
-          cons_free_list = cblk->conses[0].u.s.u.chain;
           lisp_align_free (cblk);
+	  continue;
         }
-      else
-        {
-          num_free += this_free;
-          cprev = &cblk->next;
-        }
+
+      /* The current block must be swept now, since conses will be
+	 allocated past LIM in it.  Blocks in which everything or
+	 nothing survived are cheap to sweep, or are needed to fill the
+	 free list; leave the others for sweep_conses_lazily.  */
+      if (cblk == cons_block || this_used == 0 || this_free == 0)
+	sweep_cons_block (cblk, lim);
+
+      num_used += this_used;
+      num_free += this_free;
+      record_block_occupancy (CONS_BLOCKS,
+			      this_used * sizeof (struct Lisp_Cons),
+			      sizeof cblk->conses);
+      lim = CONS_BLOCK_SIZE;
+      cprev = &cblk->next;
     }
+  cons_sweep_next = cons_block;
   gcstat.total_conses = num_used;
   gcstat.total_free_conses = num_free;
 }
 
+/* Put the unmarked floats among the first LIM ones of FBLK on the
+   free list, and unmark the others.  */
+
+static void
+sweep_float_block (struct float_block *fblk, int lim)
+{
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  ASAN_UNPOISON_FLOAT_BLOCK (fblk);
+
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      /* Fast path - all floats for this int are marked.  */
+      if (fblk->gcmarkbits[i] != BITS_WORD_MAX)
+	{
+	  int start = i * BITS_PER_BITS_WORD;
+	  int stop = start + min (lim - start, BITS_PER_BITS_WORD);
+	  for (int pos = start; pos < stop; pos++)
+	    if (!GETMARKBIT (fblk, pos))
+	      {
+		fblk->floats[pos].u.chain = float_free_list;
+		ASAN_POISON_FLOAT (&fblk->floats[pos]);
+		float_free_list = &fblk->floats[pos];
+	      }
+	}
+      fblk->gcmarkbits[i] = 0;
+    }
+}
+
+/* Sweep float blocks left over by the last collection until there is
+   a free float or no such block remains.  */
+
+static void
+sweep_floats_lazily (void)
+{
+  enum { ilim = (FLOAT_BLOCK_SIZE + BITS_PER_BITS_WORD - 1)
+		/ BITS_PER_BITS_WORD };
+  while (!float_free_list && float_sweep_next)
+    {
+      struct float_block *fblk = float_sweep_next;
+      float_sweep_next = fblk->next;
+      if (!block_unmarked_p (fblk->gcmarkbits, ilim))
+	sweep_float_block (fblk, FLOAT_BLOCK_SIZE);
+    }
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_floats (void)
@@ -6937,46 +7287,58 @@ sweep_floats (void)
 
   for (struct float_block *fblk; (fblk = *fprev); )
     {
-      int this_free = 0;
-      ASAN_UNPOISON_FLOAT_BLOCK (fblk);
-      for (int i = 0; i < lim; i++)
-	{
-	  struct Lisp_Float *afloat = &fblk->floats[i];
-	  if (!XFLOAT_MARKED_P (afloat))
-	    {
-	      this_free++;
-	      fblk->floats[i].u.chain = float_free_list;
-	      ASAN_POISON_FLOAT (&fblk->floats[i]);
-	      float_free_list = &fblk->floats[i];
-	    }
-	  else
-	    {
-	      num_used++;
-	      XFLOAT_UNMARK (afloat);
-	    }
-	}
-      lim = FLOAT_BLOCK_SIZE;
+      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      int this_used = block_marked_count (fblk->gcmarkbits, ilim);
+      int this_free = lim - this_used;
+
       /* If this block contains only free floats and we have already
          seen more than two blocks worth of free floats then deallocate
          this block.  */
       if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
         {
           *fprev = fblk->next;
-          /* Unhook from the free list.  */
 	  ASAN_UNPOISON_FLOAT (&fblk->floats[0]);
-	  float_free_list = fblk->floats[0].u.chain;
           lisp_align_free (fblk);
+	  continue;
         }
-      else
-        {
-          num_free += this_free;
-          fprev = &fblk->next;
-        }
+
+      /* Defer sweeping as sweep_conses does.  */
+      if (fblk == float_block || this_used == 0 || this_free == 0)
+	sweep_float_block (fblk, lim);
+
+      num_used += this_used;
+      num_free += this_free;
+      record_block_occupancy (FLOAT_BLOCKS,
+			      this_used * sizeof (struct Lisp_Float),
+			      sizeof fblk->floats);
+      lim = FLOAT_BLOCK_SIZE;
+      fprev = &fblk->next;
     }
+  float_sweep_next = float_block;
   gcstat.total_floats = num_used;
   gcstat.total_free_floats = num_free;
 }
 
+/* Sweep all the cons and float blocks that the last garbage
+   collection left to be swept lazily.  This must be done before
+   marking starts, and is also done when Emacs is idle.  */
+
+void
+finish_lazy_sweep (void)
+{
+  enum { cons_ilim = (CONS_BLOCK_SIZE + BITS_PER_BITS_WORD - 1)
+		     / BITS_PER_BITS_WORD,
+	 float_ilim = (FLOAT_BLOCK_SIZE + BITS_PER_BITS_WORD - 1)
+		      / BITS_PER_BITS_WORD };
+
+  for (; cons_sweep_next; cons_sweep_next = cons_sweep_next->next)
+    if (!block_unmarked_p (cons_sweep_next->gcmarkbits, cons_ilim))
+      sweep_cons_block (cons_sweep_next, CONS_BLOCK_SIZE);
+  for (; float_sweep_next; float_sweep_next = float_sweep_next->next)
+    if (!block_unmarked_p (float_sweep_next->gcmarkbits, float_ilim))
+      sweep_float_block (float_sweep_next, FLOAT_BLOCK_SIZE);
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_intervals (void)
@@ -7006,6 +7368,7 @@ sweep_intervals (void)
               iblk->intervals[i].gcmarkbit = 0;
             }
         }
+      int this_used = lim - this_free;
       lim = INTERVAL_BLOCK_SIZE;
       /* If this block contains only free intervals and we have already
          seen more than two blocks worth of free intervals then
@@ -7021,6 +7384,9 @@ sweep_intervals (void)
       else
         {
           num_free += this_free;
+	  record_block_occupancy (INTERVAL_BLOCKS,
+				  this_used * sizeof (struct interval),
+				  sizeof iblk->intervals);
           iprev = &iblk->next;
         }
     }
@@ -7079,6 +7445,7 @@ sweep_symbols (void)
             }
         }
 
+      int this_used = lim - this_free;
       lim = SYMBOL_BLOCK_SIZE;
       /* If this block contains only free symbols and we have already
          seen more than two blocks worth of free symbols then deallocate
@@ -7094,6 +7461,9 @@ sweep_symbols (void)
       else
         {
           num_free += this_free;
+	  record_block_occupancy (SYMBOL_BLOCKS,
+				  this_used * sizeof (struct Lisp_Symbol),
+				  sizeof sblk->symbols);
           sprev = &sblk->next;
         }
     }
@@ -7113,6 +7483,7 @@ unchain_dead_markers (struct buffer *buffer)
       prev = &this->next;
     else
       {
+        marker_tree_remove (this);
         this->buffer = NULL;
         *prev = this->next;
       }
@@ -7139,6 +7510,7 @@ sweep_buffers (void)
 static void
 gc_sweep (void)
 {
+  memset (block_occupancy, 0, sizeof block_occupancy);
   sweep_strings ();
   check_string_bytes (!noninteractive);
   sweep_conses ();
@@ -7425,7 +7797,12 @@ void
 init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
+  Vgc_mark_elapsed = make_float (0.0);
+  Vgc_sweep_elapsed = make_float (0.0);
+  Vgc_last_elapsed = make_float (0.0);
+  Vgc_max_elapsed = make_float (0.0);
   gcs_done = 0;
+  remember_consed_at_gc ();
 }
 
 void
@@ -7459,6 +7836,20 @@ of time.
 If this portion is smaller than `gc-cons-threshold', this is ignored.  */);
   Vgc_cons_percentage = make_float (0.1);
 
+  DEFVAR_LISP ("gc-idle-factor", Vgc_idle_factor,
+	       doc: /* Whether to collect garbage early when Emacs is idle.
+If this is a positive integer N, Emacs collects garbage when it is
+about to wait for input and more than 1/Nth of the allocation needed
+to trigger an automatic collection has taken place.  This makes it
+less likely that a collection will interrupt a command later.  A value
+of 2, for example, starts a collection while idle once half of the
+allocation allowed by `gc-cons-threshold' and `gc-cons-percentage' has
+been done.
+
+If nil, garbage is only collected when those thresholds are reached.
+See also `garbage-collect-maybe'.  */);
+  Vgc_idle_factor = Qnil;
+
   DEFVAR_INT ("pure-bytes-used", pure_bytes_used,
 	      doc: /* No longer used.  */);
 
@@ -7524,6 +7915,13 @@ build.  */);
   DEFSYM (Qfloats, "floats");
   DEFSYM (Qintervals, "intervals");
   DEFSYM (Qbuffers, "buffers");
+  DEFSYM (Qbignums, "bignums");
+  DEFSYM (Qmarkers, "markers");
+  DEFSYM (Qoverlays, "overlays");
+  DEFSYM (Qhash_tables, "hash-tables");
+  DEFSYM (Qclosures, "closures");
+  DEFSYM (Qrecords, "records");
+  DEFSYM (Qpseudovectors, "pseudovectors");
   DEFSYM (Qstring_bytes, "string-bytes");
   DEFSYM (Qvector_slots, "vector-slots");
   DEFSYM (Qheap, "heap");
@@ -7536,6 +7934,23 @@ build.  */);
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
 The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-mark-elapsed", Vgc_mark_elapsed,
+	       doc: /* Accumulated time spent marking in garbage collections.
+This is the part of `gc-elapsed' spent before sweeping starts, i.e.,
+finding the reachable objects.  The time is in seconds as a floating
+point value.  See also `gc-sweep-elapsed'.  */);
+  DEFVAR_LISP ("gc-sweep-elapsed", Vgc_sweep_elapsed,
+	       doc: /* Accumulated time spent sweeping in garbage collections.
+This is the part of `gc-elapsed' spent freeing unreachable objects.
+The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-last-elapsed", Vgc_last_elapsed,
+	       doc: /* Time elapsed in the most recent garbage collection.
+This is the pause caused by the last collection, in seconds as a
+floating point value.  See also `gc-max-elapsed'.  */);
+  DEFVAR_LISP ("gc-max-elapsed", Vgc_max_elapsed,
+	       doc: /* Longest time elapsed in a single garbage collection.
+The time is in seconds as a floating point value.  You can set this to
+0.0 to start measuring afresh, e.g. before running a benchmark.  */);
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
 
@@ -7562,6 +7977,7 @@ N should be nonnegative.  */);
   defsubr (&Sgarbage_collect);
   defsubr (&Sgarbage_collect_maybe);
   defsubr (&Sgarbage_collect_heapsize);
+  defsubr (&Smemory_fragmentation_report);
   defsubr (&Smemory_info);
   defsubr (&Smemory_use_counts);
 #if defined GNU_LINUX && defined __GLIBC__ && \
@@ -642,6 +642,7 @@ even if it is dead.  The return value is never nil.  */)
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -671,6 +672,7 @@ even if it is dead.  The return value is never nil.  */)
 
   bset_mark (b, Fmake_marker ());
   BUF_MARKERS (b) = NULL;
+  BUF_MARKER_TREE (b) = NULL;
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buffer, b);
@@ -741,7 +743,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 	{
 	  struct Lisp_Marker *m = XMARKER (obj);
 
-	  obj = build_marker (to, m->charpos, m->bytepos);
+	  obj = build_marker (to, marker_charpos (m), marker_bytepos (m));
 	  XMARKER (obj)->insertion_type = m->insertion_type;
 	}
 
@@ -876,6 +878,7 @@ Interactively, CLONE and INHIBIT-BUFFER-HOOKS are nil.  */)
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->line_index = 0;
   bset_width_table (b, Qnil);
 
 #ifdef HAVE_TREE_SITTER
@@ -2107,6 +2110,7 @@ cleaning up all windows currently displaying the buffer to be killed. */)
 	{
 	  if (m->buffer == b)
 	    {
+	      marker_tree_remove (m);
 	      m->buffer = NULL;
 	      *mp = m->next;
 	    }
@@ -2126,6 +2130,7 @@ cleaning up all windows currently displaying the buffer to be killed. */)
     {
       /* Unchain all markers of this buffer and its indirect buffers.
 	 and leave them pointing nowhere.  */
+      marker_tree_clear (b);
       for (m = BUF_MARKERS (b); m; )
 	{
 	  struct Lisp_Marker *next = m->next;
@@ -2183,6 +2188,11 @@ cleaning up all windows currently displaying the buffer to be killed. */)
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->line_index)
+    {
+      free_line_index (b->line_index);
+      b->line_index = 0;
+    }
   bset_width_table (b, Qnil);
   unblock_input ();
 
@@ -2626,6 +2636,7 @@ results, see Info node `(elisp)Swapping Text'.  */)
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (line_index, struct line_index *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield (long_line_optimizations_p, bool_bf);
@@ -2741,7 +2752,7 @@ If the multibyte flag was really changed, undo information of the
 current buffer is cleared.  */)
   (Lisp_Object flag)
 {
-  struct Lisp_Marker *tail, *markers;
+  struct Lisp_Marker *tail, *markers, *marker_tree;
   Lisp_Object btail, other;
   ptrdiff_t begv, zv;
   bool narrowed = (BEG != BEGV || Z != ZV);
@@ -2789,10 +2800,15 @@ current buffer is cleared.  */)
       ZV = ZV_BYTE;
       GPT = GPT_BYTE;
       TEMP_SET_PT_BOTH (PT_BYTE, PT_BYTE);
-
+      /* The line index may have been extended by the above calls of
+	 CHAR_TO_BYTE, but its character positions are now wrong.  */
+      invalidate_line_index (current_buffer, BEG);
 
       for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-	tail->charpos = tail->bytepos;
+	{
+	  ptrdiff_t bytepos = marker_bytepos (tail);
+	  marker_tree_move_in_place (tail, bytepos, bytepos);
+	}
 
       /* Convert multibyte form of 8-bit characters to unibyte.  */
       pos = BEG;
@@ -2943,16 +2959,20 @@ current buffer is cleared.  */)
       }
 
       tail = markers = BUF_MARKERS (current_buffer);
+      marker_tree = BUF_MARKER_TREE (current_buffer);
 
       /* This prevents BYTE_TO_CHAR (that is, buf_bytepos_to_charpos) from
 	 getting confused by the markers that have not yet been updated.
 	 It is also a signal that it should never create a marker.  */
       BUF_MARKERS (current_buffer) = NULL;
+      BUF_MARKER_TREE (current_buffer) = NULL;
 
+      /* This moves no marker past another, so the tree stays
+	 ordered.  */
       for (; tail; tail = tail->next)
 	{
-	  tail->bytepos = advance_to_char_boundary (tail->bytepos);
-	  tail->charpos = BYTE_TO_CHAR (tail->bytepos);
+	  ptrdiff_t bytepos = advance_to_char_boundary (marker_bytepos (tail));
+	  marker_tree_move_in_place (tail, BYTE_TO_CHAR (bytepos), bytepos);
 	}
 
       /* Make sure no markers were put on the chain
@@ -2961,6 +2981,7 @@ current buffer is cleared.  */)
 	emacs_abort ();
 
       BUF_MARKERS (current_buffer) = markers;
+      BUF_MARKER_TREE (current_buffer) = marker_tree;
 
       /* Do this last, so it can calculate the new correspondences
 	 between chars and bytes.  */
@@ -141,6 +141,9 @@ enum { BEG = 1, BEG_BYTE = BEG };
 /* Marker chain of buffer.  */
 #define BUF_MARKERS(buf) ((buf)->text->markers)
 
+/* Marker tree of buffer.  */
+#define BUF_MARKER_TREE(buf) ((buf)->text->marker_tree)
+
 #define BUF_UNCHANGED_MODIFIED(buf) \
   ((buf)->text->unchanged_modified)
 
@@ -290,10 +293,13 @@ struct buffer_text
        successive elements in its marker `chain'
        are the other markers referring to this buffer.
        This is a singly linked unordered list, which means that it's
-       very cheap to add a marker to the list and it's also very cheap
-       to move a marker within a buffer.  */
+       very cheap to add a marker to the list.  */
     struct Lisp_Marker *markers;
 
+    /* The root of the tree of the same markers, ordered by position.
+       See marker.c.  */
+    struct Lisp_Marker *marker_tree;
+
     /* Usually false.  Temporarily true in decode_coding_gap to
        prevent Fgarbage_collect from shrinking the gap and losing
        not-yet-decoded bytes.  */
@@ -697,6 +703,13 @@ struct buffer
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* The line index, which records the number of newlines before
+     positions spread through the buffer, so that line numbers can be
+     computed without counting newlines from the beginning of the
+     buffer.  Like the caches above, it is kept in the base buffer
+     only.  See search.c.  */
+  struct line_index *line_index;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -523,6 +523,14 @@ multibyte_chars_in_text (const unsigned char *ptr, ptrdiff_t nbytes)
 
   while (ptr < endp)
     {
+      if (*ptr < 0x80)
+	{
+	  ptrdiff_t n = ascii_prefix_length (ptr, endp - ptr);
+	  ptr += n;
+	  chars += n;
+	  continue;
+	}
+
       int len = multibyte_length (ptr, endp, true, true);
 
       if (len == 0)
@@ -552,6 +560,12 @@ parse_str_as_multibyte (const unsigned char *str, ptrdiff_t len,
       const unsigned char *adjusted_endp = endp - (MAX_MULTIBYTE_LENGTH - 1);
       while (str < adjusted_endp)
 	{
+	  if (*str < 0x80)
+	    {
+	      ptrdiff_t n = ascii_prefix_length (str, adjusted_endp - str);
+	      str += n, bytes += n, chars += n;
+	      continue;
+	    }
 	  int n = multibyte_length (str, NULL, false, false);
 	  if (0 < n)
 	    str += n, bytes += n;
@@ -596,6 +610,12 @@ str_as_multibyte (unsigned char *str, ptrdiff_t len, ptrdiff_t nbytes,
       unsigned char *adjusted_endp = endp - (MAX_MULTIBYTE_LENGTH - 1);
       while (p < adjusted_endp)
 	{
+	  if (*p < 0x80)
+	    {
+	      ptrdiff_t n = ascii_prefix_length (p, adjusted_endp - p);
+	      p += n, chars += n;
+	      continue;
+	    }
 	  int n = multibyte_length (p, NULL, false, false);
 	  if (n <= 0)
 	    break;
@@ -670,8 +690,14 @@ count_size_as_multibyte (const unsigned char *str, ptrdiff_t len)
 {
   /* Count the number of non-ASCII (raw) bytes, since they will occupy
      two bytes in a multibyte string.  */
-  ptrdiff_t nonascii = 0;
-  for (ptrdiff_t i = 0; i < len; i++)
+  ptrdiff_t nonascii = 0, i = 0;
+  uintptr_t w;
+  for (; i <= len - (ptrdiff_t) sizeof w; i += sizeof w)
+    {
+      memcpy (&w, str + i, sizeof w);
+      nonascii += stdc_count_ones (w & ASCII_WORD_HIGH_BITS);
+    }
+  for (; i < len; i++)
     nonascii += str[i] >> 7;
   ptrdiff_t bytes;
   if (ckd_add (&bytes, len, nonascii))
@@ -692,7 +718,11 @@ str_to_multibyte (unsigned char *dst, const unsigned char *src,
     {
       unsigned char c = src[i];
       if (c <= 0x7f)
-	*d++ = c;
+	{
+	  ptrdiff_t n = ascii_prefix_length (src + i, nchars - i);
+	  d = mempcpy (d, src + i, n);
+	  i += n - 1;
+	}
       else
 	{
 	  *d++ = 0xc0 + ((c >> 6) & 1);
@@ -154,6 +154,29 @@ make_char_multibyte (int c)
 /* This is the maximum byte length of multibyte form.  */
 enum { MAX_MULTIBYTE_LENGTH = 5 };
 
+/* A word with the high bit of each of its bytes set.  A word of text
+   ANDed with this is zero iff all of its bytes are ASCII.  */
+#define ASCII_WORD_HIGH_BITS (UINTPTR_MAX / UCHAR_MAX * 0x80)
+
+/* Return the number of ASCII bytes at the start of the LEN bytes at
+   P.  Text is usually mostly ASCII, so look at a word at a time.  */
+INLINE ptrdiff_t
+ascii_prefix_length (const unsigned char *p, ptrdiff_t len)
+{
+  ptrdiff_t i = 0;
+  uintptr_t w;
+
+  for (; i <= len - (ptrdiff_t) sizeof w; i += sizeof w)
+    {
+      memcpy (&w, p + i, sizeof w);
+      if (w & ASCII_WORD_HIGH_BITS)
+	break;
+    }
+  while (i < len && p[i] < 0x80)
+    i++;
+  return i;
+}
+
 /* Nonzero iff C is valid as a character code.  */
 INLINE bool
 CHAR_VALID_P (intmax_t c)
@@ -1156,6 +1156,13 @@ detect_coding_utf_8 (struct coding_system *coding,
     {
       int c, c1, c2, c3, c4;
 
+      if (! multibytep)
+	{
+	  /* Skip a run of ASCII bytes at once.  */
+	  ptrdiff_t n = ascii_prefix_length (src, src_end - src);
+	  src += n;
+	  nchars += n;
+	}
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0 || UTF_8_1_OCTET_P (c))
@@ -1296,39 +1303,69 @@ decode_coding_utf_8 (struct coding_system *coding)
 	  break;
 	}
 
-      /* In the simple case, rapidly handle ordinary characters */
-      if (multibytep && ! eol_dos
+      /* In the simple case, rapidly handle ordinary characters.  Copy
+	 runs of ASCII bytes a word at a time, and when the source is
+	 unibyte also decode valid 2- and 3-byte sequences here, since
+	 they are what non-ASCII text mostly consists of.  */
+      if (! eol_dos
 	  && charbuf < charbuf_end - 6 && src < src_end - 6)
 	{
 	  while (charbuf < charbuf_end - 6 && src < src_end - 6)
 	    {
-	      c1 = *src;
-	      if (c1 & 0x80)
-		break;
-	      src++;
-	      consumed_chars++;
-	      *charbuf++ = c1;
+	      uintptr_t w;
 
-	      c1 = *src;
-	      if (c1 & 0x80)
-		break;
-	      src++;
-	      consumed_chars++;
-	      *charbuf++ = c1;
+	      if (charbuf_end - 6 - charbuf >= (ptrdiff_t) sizeof w
+		  && src_end - 6 - src >= (ptrdiff_t) sizeof w)
+		{
+		  memcpy (&w, src, sizeof w);
+		  if (! (w & ASCII_WORD_HIGH_BITS))
+		    {
+		      for (int i = 0; i < (int) sizeof w; i++)
+			charbuf[i] = src[i];
+		      charbuf += sizeof w;
+		      src += sizeof w;
+		      consumed_chars += sizeof w;
+		      continue;
+		    }
+		}
 
+	      /* As the source is unibyte when decoding non-ASCII bytes
+		 here, each byte consumed counts as a character.  */
 	      c1 = *src;
-	      if (c1 & 0x80)
+	      if (UTF_8_1_OCTET_P (c1))
+		{
+		  src++;
+		  consumed_chars++;
+		  c = c1;
+		}
+	      else if (multibytep)
 		break;
-	      src++;
-	      consumed_chars++;
-	      *charbuf++ = c1;
-
-	      c1 = *src;
-	      if (c1 & 0x80)
+	      else if (UTF_8_2_OCTET_LEADING_P (c1))
+		{
+		  c2 = src[1];
+		  if (c1 < 0xC2 || ! UTF_8_EXTRA_OCTET_P (c2))
+		    break;
+		  src += 2;
+		  consumed_chars += 2;
+		  c = ((c1 & 0x1F) << 6) | (c2 & 0x3F);
+		}
+	      else if (UTF_8_3_OCTET_LEADING_P (c1))
+		{
+		  c2 = src[1];
+		  c3 = src[2];
+		  if (! (UTF_8_EXTRA_OCTET_P (c2) && UTF_8_EXTRA_OCTET_P (c3)))
+		    break;
+		  c = (((c1 & 0xF) << 12)
+		       | ((c2 & 0x3F) << 6) | (c3 & 0x3F));
+		  if (c < 0x800
+		      || (c >= 0xd800 && c < 0xe000)) /* surrogates (invalid) */
+		    break;
+		  src += 3;
+		  consumed_chars += 3;
+		}
+	      else
 		break;
-	      src++;
-	      consumed_chars++;
-	      *charbuf++ = c1;
+	      *charbuf++ = c;
 	    }
 	  /* If we handled at least one character, restart the main loop.  */
 	  if (src != src_base)
@@ -1472,6 +1509,12 @@ encode_coding_utf_8 (struct coding_system *coding)
 
       while (charbuf < charbuf_end)
 	{
+	  /* Copy a run of ASCII characters without further checks.  */
+	  for (ptrdiff_t n = min (charbuf_end - charbuf, dst_end - dst);
+	       0 < n && ASCII_CHAR_P (*charbuf); n--)
+	    *dst++ = *charbuf++;
+	  if (charbuf == charbuf_end)
+	    break;
 	  ASSURE_DESTINATION (safe_room);
 	  c = *charbuf++;
 	  if (CHAR_BYTE8_P (c))
@@ -6176,15 +6219,16 @@ check_ascii (struct coding_system *coding)
   src = coding->source;
   end = src + coding->src_bytes;
 
+  ptrdiff_t nascii = ascii_prefix_length (src, end - src);
   if (inhibit_eol_conversion
-      || SYMBOLP (eol_type))
+      || SYMBOLP (eol_type)
+      || ! memchr (src, '\r', nascii))
     {
-      /* We don't have to check EOL format.  */
-      while (src < end && !( *src & 0x80))
-	{
-	  if (*src++ == '\n')
-	    eol_seen |= EOL_SEEN_LF;
-	}
+      /* We don't have to check EOL format, or there are only LFs to
+	 find.  */
+      if (memchr (src, '\n', nascii))
+	eol_seen |= EOL_SEEN_LF;
+      src += nascii;
     }
   else
     {
@@ -6252,12 +6296,28 @@ check_utf_8 (struct coding_system *coding)
   /* We look ahead one byte for CR LF.  */
   end = coding->source + coding->src_bytes - 1;
   eol_seen = coding->eol_seen;
+  /* The end of the run of ASCII bytes containing SRC, if known.  */
+  const unsigned char *ascii_end = src;
   while (src < end)
     {
       int c = *src;
 
       if (UTF_8_1_OCTET_P (*src))
 	{
+	  /* Skip the ASCII bytes up to the next CR at once.  */
+	  if (ascii_end <= src)
+	    ascii_end = src + ascii_prefix_length (src, end - src);
+	  const unsigned char *stop = memchr (src, '\r', ascii_end - src);
+	  if (!stop)
+	    stop = ascii_end;
+	  if (src < stop)
+	    {
+	      if (memchr (src, '\n', stop - src))
+		eol_seen |= EOL_SEEN_LF;
+	      nchars += stop - src;
+	      src = stop;
+	      continue;
+	    }
 	  src++;
 	  if (c < 0x20)
 	    {
@@ -6528,6 +6588,22 @@ detect_coding (struct coding_system *coding)
       coding->head_ascii = 0;
       for (src = coding->source; src < src_end; src++)
 	{
+	  /* Skip words of printable ASCII bytes at once, as none of
+	     them can affect the detection.  */
+	  uintptr_t w;
+	  while (src_end - src >= (ptrdiff_t) sizeof w)
+	    {
+	      memcpy (&w, src, sizeof w);
+	      if ((w | ((w - ASCII_WORD_HIGH_BITS / 0x80 * 0x20) & ~w))
+		  & ASCII_WORD_HIGH_BITS)
+		break;
+	      if (! eight_bit_found)
+		coding->head_ascii += sizeof w;
+	      src += sizeof w;
+	    }
+	  if (src == src_end)
+	    break;
+
 	  c = *src;
 	  if (c & 0x80)
 	    {
@@ -7343,6 +7419,7 @@ decode_coding (struct coding_system *coding)
   int carryover;
   int i;
   specpdl_ref count = SPECPDL_INDEX ();
+  Lisp_Object outer_frame = enter_c_frame (QDecoding);
 
   USE_SAFE_ALLOCA;
 
@@ -7484,6 +7561,7 @@ decode_coding (struct coding_system *coding)
       record_insert (coding->dst_pos, coding->produced_char);
     }
 
+  exit_c_frame (outer_frame);
   SAFE_FREE_UNBIND_TO (count, Qnil);
 }
 
@@ -7760,6 +7838,7 @@ encode_coding (struct coding_system *coding)
   Lisp_Object translation_table;
   int max_lookup;
   struct ccl_spec cclspec;
+  Lisp_Object outer_frame = enter_c_frame (QEncoding);
 
   USE_SAFE_ALLOCA;
 
@@ -7804,6 +7883,7 @@ encode_coding (struct coding_system *coding)
     insert_from_gap (coding->produced_char, coding->produced, 0,
 		     coding->insert_before_markers);
 
+  exit_c_frame (outer_frame);
   SAFE_FREE ();
 }
 
@@ -8106,7 +8186,8 @@ decode_coding_object (struct coding_system *coding,
 	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
 	    {
 	      tail->need_adjustment
-		= tail->charpos == (tail->insertion_type ? from : to);
+		= (marker_charpos (tail)
+		   == (tail->insertion_type ? from : to));
 	      need_marker_adjustment |= tail->need_adjustment;
 	    }
 	  saved_pt = PT, saved_pt_byte = PT_BYTE;
@@ -8240,17 +8321,14 @@ decode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  attach_marker (tail, tail->buffer, from, from_byte);
 		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
+		  attach_marker
+		    (tail, tail->buffer,
+		     (NILP (BVAR (current_buffer, enable_multibyte_characters))
+		      ? from_byte + coding->produced
+		      : from + coding->produced_char),
+		     from_byte + coding->produced);
 	      }
 	}
     }
@@ -8328,7 +8406,8 @@ encode_coding_object (struct coding_system *coding,
       for (tail = BUF_MARKERS (XBUFFER (src_object)); tail; tail = tail->next)
 	{
 	  tail->need_adjustment
-	    = tail->charpos == (tail->insertion_type ? from : to);
+	    = (marker_charpos (tail)
+	       == (tail->insertion_type ? from : to));
 	  need_marker_adjustment |= tail->need_adjustment;
 	}
     }
@@ -8495,17 +8574,14 @@ encode_coding_object (struct coding_system *coding,
 	      {
 		tail->need_adjustment = 0;
 		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
+		  attach_marker (tail, tail->buffer, from, from_byte);
 		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
+		  attach_marker
+		    (tail, tail->buffer,
+		     (NILP (BVAR (current_buffer, enable_multibyte_characters))
+		      ? from_byte + coding->produced
+		      : from + coding->produced_char),
+		     from_byte + coding->produced);
 	      }
 	}
     }
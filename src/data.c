@@ -291,6 +291,8 @@ a fixed set of types.  */)
 	  return Qtreesit_compiled_query;
         case PVEC_SQLITE:
           return Qsqlite;
+        case PVEC_COMPILED_REGEXP:
+          return Qcompiled_regexp;
         case PVEC_SUB_CHAR_TABLE:
           return Qsub_char_table;
         /* "Impossible" cases.  */
@@ -4237,6 +4239,7 @@ syms_of_data (void)
   DEFSYM (Qtreesit_parser, "treesit-parser");
   DEFSYM (Qtreesit_node, "treesit-node");
   DEFSYM (Qtreesit_compiled_query, "treesit-compiled-query");
+  DEFSYM (Qcompiled_regexp, "compiled-regexp");
   DEFSYM (Qobarray, "obarray");
 
   DEFSYM (Qdefun, "defun");
@@ -2230,6 +2230,119 @@ a buffer or a string.  But this is deprecated.  */)
   return Qt;
 }
 
+DEFUN ("replace-regions", Freplace_regions, Sreplace_regions, 1, 2, 0,
+       doc: /* Replace several regions of the current buffer at once.
+EDITS is a list or vector of elements (BEG END REPLACEMENT), each of
+which says to replace the text between BEG and END with REPLACEMENT.
+REPLACEMENT can be a string, or a vector [SBUF SBEG SEND] denoting the
+substring SBEG..SEND of another buffer SBUF.  The elements must be
+sorted by position and their regions must not overlap, though a region
+can end where the next one begins.  All positions refer to the text as
+it was before any of the replacements.
+
+If optional argument INHERIT is non-nil, the inserted text will inherit
+properties from adjoining text.
+
+Markers and point are relocated as if each replacement had been made
+with `delete-region' and `insert'.  The modification hooks are called
+only once, for the text from the beginning of the first region to the
+end of the last one, and the replacements are undone together.  This
+makes the function much faster than making many replacements
+separately.  Return nil.  */)
+  (Lisp_Object edits, Lisp_Object inherit)
+{
+  Lisp_Object v = CALLN (Fvconcat, edits);
+  ptrdiff_t n = ASIZE (v);
+  if (n == 0)
+    return Qnil;
+
+  struct buffer *a = current_buffer;
+  ptrdiff_t *pos;
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (pos, 2, n);
+
+  /* Check all the edits before making any of them, and replace each
+     element of V with its REPLACEMENT, in the form that
+     'replace_range' accepts.  */
+  ptrdiff_t prev_end = BEGV, growth = 0;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object edit = AREF (v, i);
+      Lisp_Object beg = Fcar (edit);
+      Lisp_Object end = Fcar (Fcdr (edit));
+      Lisp_Object replacement = Fcar (Fcdr (Fcdr (edit)));
+      validate_region (&beg, &end);
+      if (XFIXNUM (beg) < prev_end)
+	error ("Regions to replace overlap or are not sorted");
+      ptrdiff_t inschars;
+      if (STRINGP (replacement))
+	inschars = SCHARS (replacement);
+      else
+	{
+	  CHECK_TYPE (VECTORP (replacement),
+		      list (Qor, Qstring, Qvector), replacement);
+	  /* Let Faref signal an error if REPLACEMENT is too small.  */
+	  Lisp_Object send = Faref (replacement, make_fixnum (2));
+	  Lisp_Object sbeg = AREF (replacement, 1);
+	  Lisp_Object sbuf = AREF (replacement, 0);
+	  CHECK_BUFFER (sbuf);
+	  struct buffer *b = XBUFFER (sbuf);
+	  if (!BUFFER_LIVE_P (b))
+	    error ("Selecting deleted buffer");
+	  if (b == a)
+	    error ("Cannot replace a buffer with itself");
+	  specpdl_ref count = SPECPDL_INDEX ();
+	  record_unwind_current_buffer ();
+	  set_buffer_internal (b);
+	  validate_region (&sbeg, &send);
+	  unbind_to (count, Qnil);
+	  inschars = XFIXNUM (send) - XFIXNUM (sbeg);
+	  replacement = CALLN (Fvector, sbuf, sbeg, send);
+	}
+      ASET (v, i, replacement);
+      pos[2 * i] = XFIXNUM (beg);
+      pos[2 * i + 1] = prev_end = XFIXNUM (end);
+      growth += inschars - (XFIXNUM (end) - XFIXNUM (beg));
+    }
+
+  ptrdiff_t min_a = pos[0];
+  ptrdiff_t max_a = pos[2 * n - 1];
+  specpdl_ref count = SPECPDL_INDEX ();
+  Fundo_boundary ();
+  bool modification_hooks_inhibited = false;
+
+  /* As in 'replace-region-contents', announce a single modification
+     for the entire modified region, unless the caller inhibited
+     modification hooks.  */
+  if (!inhibit_modification_hooks)
+    {
+      prepare_to_modify_buffer (min_a, max_a, NULL);
+      specbind (Qinhibit_modification_hooks, Qt);
+      modification_hooks_inhibited = true;
+    }
+
+  /* Make the replacements from the last one to the first, so that the
+     positions of the regions not yet replaced stay valid, and the gap
+     moves through the text only once.  */
+  for (ptrdiff_t i = n - 1; 0 <= i; i--)
+    replace_range (pos[2 * i], pos[2 * i + 1], AREF (v, i),
+		   true, !NILP (inherit), false);
+
+  unbind_to (count, Qnil);
+
+  if (modification_hooks_inhibited)
+    {
+      signal_after_change (min_a, max_a - min_a, max_a - min_a + growth);
+      update_compositions (min_a, max_a + growth, CHECK_INSIDE);
+      if (SAVE_MODIFF == MODIFF
+	  && STRINGP (BVAR (a, file_truename)))
+	Funlock_file (BVAR (a, file_truename));
+    }
+
+  SAFE_FREE ();
+  return Qnil;
+}
+
 static void
 set_bit (unsigned char *a, ptrdiff_t i)
 {
@@ -3088,21 +3201,26 @@ save_restriction_restore_1 (Lisp_Object data)
       eassert (buf == end->buffer);
 
       if (buf /* Verify marker still points to a buffer.  */
-	  && (beg->charpos != BUF_BEGV (buf) || end->charpos != BUF_ZV (buf)))
+	  && (marker_charpos (beg) != BUF_BEGV (buf)
+	      || marker_charpos (end) != BUF_ZV (buf)))
 	/* The restriction has changed from the saved one, so restore
 	   the saved restriction.  */
 	{
 	  ptrdiff_t pt = BUF_PT (buf);
+	  ptrdiff_t beg_charpos = marker_charpos (beg);
+	  ptrdiff_t beg_bytepos = marker_bytepos (beg);
+	  ptrdiff_t end_charpos = marker_charpos (end);
+	  ptrdiff_t end_bytepos = marker_bytepos (end);
 
-	  SET_BUF_BEGV_BOTH (buf, beg->charpos, beg->bytepos);
-	  SET_BUF_ZV_BOTH (buf, end->charpos, end->bytepos);
+	  SET_BUF_BEGV_BOTH (buf, beg_charpos, beg_bytepos);
+	  SET_BUF_ZV_BOTH (buf, end_charpos, end_bytepos);
 
-	  if (pt < beg->charpos || pt > end->charpos)
+	  if (pt < beg_charpos || pt > end_charpos)
 	    /* The point is outside the new visible range, move it inside. */
 	    SET_BUF_PT_BOTH (buf,
-			     clip_to_bounds (beg->charpos, pt, end->charpos),
-			     clip_to_bounds (beg->bytepos, BUF_PT_BYTE (buf),
-					     end->bytepos));
+			     clip_to_bounds (beg_charpos, pt, end_charpos),
+			     clip_to_bounds (beg_bytepos, BUF_PT_BYTE (buf),
+					     end_bytepos));
 
 	  buf->clip_changed = 1; /* Remember that the narrowing changed. */
 	}
@@ -4509,31 +4627,38 @@ transpose_markers (ptrdiff_t start1, ptrdiff_t end1,
   amt1_byte = (end2_byte - start2_byte) + (start2_byte - end1_byte);
   amt2_byte = (end1_byte - start1_byte) + (start2_byte - end1_byte);
 
-  for (marker = BUF_MARKERS (current_buffer); marker; marker = marker->next)
+  /* Collect the markers to move first, as moving them changes the
+     order of the marker tree.  */
+  ptrdiff_t nmarkers = 0;
+  for (marker = marker_tree_ceiling (current_buffer, start1);
+       marker && marker_charpos (marker) < end2;
+       marker = marker_tree_next (marker))
+    nmarkers++;
+  if (!nmarkers)
+    return;
+
+  struct Lisp_Marker **markers;
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (markers, 1, nmarkers);
+  marker = marker_tree_ceiling (current_buffer, start1);
+  for (ptrdiff_t i = 0; i < nmarkers; i++, marker = marker_tree_next (marker))
+    markers[i] = marker;
+
+  for (ptrdiff_t i = 0; i < nmarkers; i++)
     {
-      mpos = marker->bytepos;
-      if (mpos >= start1_byte && mpos < end2_byte)
-	{
-	  if (mpos < end1_byte)
-	    mpos += amt1_byte;
-	  else if (mpos < start2_byte)
-	    mpos += diff_byte;
-	  else
-	    mpos -= amt2_byte;
-	  marker->bytepos = mpos;
-	}
-      mpos = marker->charpos;
-      if (mpos >= start1 && mpos < end2)
-	{
-	  if (mpos < end1)
-	    mpos += amt1;
-	  else if (mpos < start2)
-	    mpos += diff;
-	  else
-	    mpos -= amt2;
-	}
-      marker->charpos = mpos;
+      ptrdiff_t mpos_byte;
+      marker = markers[i];
+      mpos = marker_charpos (marker);
+      mpos_byte = marker_bytepos (marker);
+      if (mpos < end1)
+	mpos += amt1, mpos_byte += amt1_byte;
+      else if (mpos < start2)
+	mpos += diff, mpos_byte += diff_byte;
+      else
+	mpos -= amt2, mpos_byte -= amt2_byte;
+      attach_marker (marker, marker->buffer, mpos, mpos_byte);
     }
+  SAFE_FREE ();
 }
 
 DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
@@ -4962,6 +5087,7 @@ know how to get the kernel version on the underlying OS.  */);
   defsubr (&Sinsert_buffer_substring);
   defsubr (&Scompare_buffer_substrings);
   defsubr (&Sreplace_region_contents);
+  defsubr (&Sreplace_regions);
   defsubr (&Ssubst_char_in_region);
   defsubr (&Stranslate_region_internal);
   defsubr (&Sdelete_region);
@@ -1457,6 +1457,7 @@ unwind_to_catch (struct handler *catch, enum nonlocal_exit type,
 
   lisp_eval_depth = catch->f_lisp_eval_depth;
   set_act_rec (current_thread, catch->act_rec);
+  current_thread->c_frame = catch->c_frame;
 
   sys_longjmp (catch->jmp, 1);
 }
@@ -1859,6 +1860,7 @@ push_handler_nosignal (Lisp_Object tag_ch_val, enum handlertype handlertype)
   c->act_rec = get_act_rec (current_thread);
   c->poll_suppress_count = poll_suppress_count;
   c->interrupt_input_blocked = interrupt_input_blocked;
+  c->c_frame = current_thread->c_frame;
 #ifdef HAVE_X_WINDOWS
   c->x_error_handler_depth = x_error_message_count;
 #endif
@@ -4412,6 +4414,25 @@ get_backtrace (Lisp_Object *array, ptrdiff_t size)
     array[i] = Qnil;
 }
 
+/* Like get_backtrace, but for the thread TSTATE.  */
+void
+get_thread_backtrace (struct thread_state *tstate, Lisp_Object *array,
+		      ptrdiff_t size)
+{
+  if (tstate == current_thread)
+    {
+      get_backtrace (array, size);
+      return;
+    }
+  union specbinding *pdl = backtrace_thread_top (tstate);
+  ptrdiff_t i = 0;
+  for (; i < size && backtrace_thread_p (tstate, pdl);
+       i++, pdl = backtrace_thread_next (tstate, pdl))
+    array[i] = backtrace_function (pdl);
+  for (; i < size; i++)
+    array[i] = Qnil;
+}
+
 Lisp_Object backtrace_top_function (void)
 {
   union specbinding *pdl = backtrace_top ();
@@ -4120,6 +4120,12 @@ by calling `format-decode', which see.  */)
   Lisp_Object coding_system;
   /* errno if read error, 0 if OK so far, negative if quit.  */
   int read_quit = 0;
+  /* Start times of the phases recorded in
+     `insert-file-contents-elapsed', if it is non-nil.  */
+  bool timing = !NILP (Vinsert_file_contents_elapsed);
+  struct timespec read_start = invalid_timespec ();
+  struct timespec detect_start UNINIT, decode_start UNINIT;
+  struct timespec finish_start UNINIT;
   /* If the undo log only contains the insertion, there's no point
      keeping it.  It's typically when we first fill a file-buffer.  */
   bool empty_undo_list_p
@@ -4913,6 +4919,17 @@ by calling `format-decode', which see.  */)
   /* Total bytes inserted.  */
   inserted = 0;
 
+  if (timing)
+    read_start = current_timespec ();
+
+#if defined HAVE_POSIX_FADVISE && !defined WINDOWSNT
+  /* A large file is read once from start to end, so ask the kernel
+     to read ahead more aggressively.  */
+  if (regular && total > INSERT_READ_SIZE_MAX && 0 <= emacs_fd_to_int (fd))
+    posix_fadvise (emacs_fd_to_int (fd), beg_offset, total,
+		   POSIX_FADV_SEQUENTIAL);
+#endif
+
   /* Here, we don't do code conversion in the loop.  It is done by
      decode_coding_gap after all data are read into the buffer.  */
   {
@@ -5015,6 +5032,9 @@ by calling `format-decode', which see.  */)
 
  notfound:
 
+  if (timing)
+    detect_start = current_timespec ();
+
   if (NILP (coding_system))
     {
       /* The coding system is not yet decided.  Decide it by an
@@ -5102,6 +5122,9 @@ by calling `format-decode', which see.  */)
 
   eassert (PT == GPT);
 
+  if (timing)
+    decode_start = current_timespec ();
+
   coding.dst_multibyte
     = !NILP (BVAR (current_buffer, enable_multibyte_characters));
   if (CODING_MAY_REQUIRE_DECODING (&coding)
@@ -5126,6 +5149,9 @@ by calling `format-decode', which see.  */)
 			   inserted);
     }
 
+  if (timing)
+    finish_start = current_timespec ();
+
   /* Call after-change hooks for the inserted text, aside from the case
      of normal visiting (not with REPLACE), which is done in a new buffer
      "before" the buffer is changed.  */
@@ -5324,6 +5350,20 @@ by calling `format-decode', which see.  */)
                              current_buffer->newline_cache,
                              PT - BEG, Z - PT - inserted);
 
+  if (timespec_valid_p (read_start))
+    {
+      struct timespec finish_end = current_timespec ();
+      Vinsert_file_contents_elapsed
+	= list4 (make_float (timespectod (timespec_sub (detect_start,
+							read_start))),
+		 make_float (timespectod (timespec_sub (decode_start,
+							detect_start))),
+		 make_float (timespectod (timespec_sub (finish_start,
+							decode_start))),
+		 make_float (timespectod (timespec_sub (finish_end,
+							finish_start))));
+    }
+
   if (read_quit)
     quit ();
 
@@ -6896,6 +6936,18 @@ If `insert-file-contents' is intercepted by a handler from
 functions in `after-insert-file-functions' if appropriate.  */);
   Vafter_insert_file_functions = Qnil;
 
+  DEFVAR_LISP ("insert-file-contents-elapsed", Vinsert_file_contents_elapsed,
+	       doc: /* Time spent in the phases of the last `insert-file-contents'.
+If this is non-nil, `insert-file-contents' sets it to a list
+\(READ DETECT DECODE FINISH) of the times spent reading the file,
+deciding its coding system, decoding and inserting the text, and
+running the functions that post-process the inserted text, such as
+`after-insert-file-functions'.  The times are in seconds as floating
+point values.  Calls that find no file, or that replace buffer text
+in place because of the REPLACE argument, leave this variable
+unchanged.  The default value nil means don't measure.  */);
+  Vinsert_file_contents_elapsed = Qnil;
+
   DEFVAR_LISP ("write-region-annotate-functions", Vwrite_region_annotate_functions,
 	       doc: /* A list of functions to be called at the start of `write-region'.
 Each is passed two arguments, START and END as for `write-region'.
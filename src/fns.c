@@ -1188,6 +1188,56 @@ static Lisp_Object string_char_byte_cache_string;
 static ptrdiff_t string_char_byte_cache_charpos;
 static ptrdiff_t string_char_byte_cache_bytepos;
 
+/* For a large multibyte string looked up far from the cached position
+   above, record the byte index of every STRING_CHAR_BYTE_SPACING'th
+   character, so that further lookups in that string need to scan at
+   most that many characters.  */
+enum { STRING_CHAR_BYTE_SPACING = 1024 };
+
+static Lisp_Object string_char_byte_index_string;
+static ptrdiff_t *string_char_byte_index;
+static ptrdiff_t string_char_byte_index_used, string_char_byte_index_size;
+
+/* Make string_char_byte_index describe STRING, unless it already
+   does.  */
+static void
+index_string_char_bytes (Lisp_Object string)
+{
+  if (BASE_EQ (string, string_char_byte_index_string))
+    return;
+
+  ptrdiff_t nchars = SCHARS (string);
+  ptrdiff_t n = nchars / STRING_CHAR_BYTE_SPACING + 1;
+  if (string_char_byte_index_size < n)
+    string_char_byte_index
+      = xpalloc (string_char_byte_index, &string_char_byte_index_size,
+		 n - string_char_byte_index_size, -1,
+		 sizeof *string_char_byte_index);
+
+  unsigned char *p = SDATA (string);
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      string_char_byte_index[i] = p - SDATA (string);
+      ptrdiff_t chars = min (STRING_CHAR_BYTE_SPACING,
+			     nchars - i * STRING_CHAR_BYTE_SPACING);
+      for (ptrdiff_t j = 0; j < chars; j++)
+	p += BYTES_BY_CHAR_HEAD (*p);
+    }
+  string_char_byte_index_used = n;
+  string_char_byte_index_string = string;
+}
+
+/* Forget what the caches above know about the character and byte
+   indices of STRING, whose characters changed.  */
+static void
+clear_string_char_byte_cache (Lisp_Object string)
+{
+  if (BASE_EQ (string, string_char_byte_cache_string))
+    string_char_byte_cache_string = Qnil;
+  if (BASE_EQ (string, string_char_byte_index_string))
+    string_char_byte_index_string = Qnil;
+}
+
 /* Return the byte index corresponding to CHAR_INDEX in STRING.  */
 
 ptrdiff_t
@@ -1217,6 +1267,20 @@ string_char_to_byte (Lisp_Object string, ptrdiff_t char_index)
 	}
     }
 
+  if (char_index - best_below > STRING_CHAR_BYTE_SPACING
+      && best_above - char_index > STRING_CHAR_BYTE_SPACING)
+    {
+      index_string_char_bytes (string);
+      ptrdiff_t i = char_index / STRING_CHAR_BYTE_SPACING;
+      best_below = i * STRING_CHAR_BYTE_SPACING;
+      best_below_byte = string_char_byte_index[i];
+      if (i + 1 < string_char_byte_index_used)
+	{
+	  best_above = best_below + STRING_CHAR_BYTE_SPACING;
+	  best_above_byte = string_char_byte_index[i + 1];
+	}
+    }
+
   if (char_index - best_below < best_above - char_index)
     {
       unsigned char *p = SDATA (string) + best_below_byte;
@@ -1277,6 +1341,28 @@ string_byte_to_char (Lisp_Object string, ptrdiff_t byte_index)
 	}
     }
 
+  if (byte_index - best_below_byte > STRING_CHAR_BYTE_SPACING
+      && best_above_byte - byte_index > STRING_CHAR_BYTE_SPACING)
+    {
+      index_string_char_bytes (string);
+      ptrdiff_t lo = 0, hi = string_char_byte_index_used;
+      while (hi - lo > 1)
+	{
+	  ptrdiff_t mid = lo + (hi - lo) / 2;
+	  if (string_char_byte_index[mid] <= byte_index)
+	    lo = mid;
+	  else
+	    hi = mid;
+	}
+      best_below = lo * STRING_CHAR_BYTE_SPACING;
+      best_below_byte = string_char_byte_index[lo];
+      if (hi < string_char_byte_index_used)
+	{
+	  best_above = hi * STRING_CHAR_BYTE_SPACING;
+	  best_above_byte = string_char_byte_index[hi];
+	}
+    }
+
   if (byte_index - best_below_byte < best_above_byte - byte_index)
     {
       unsigned char *p = SDATA (string) + best_below_byte;
@@ -2963,7 +3049,8 @@ internal_equal_1 (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	  case PVEC_MARKER:
 	    return (XMARKER (o1)->buffer == XMARKER (o2)->buffer
 		    && (XMARKER (o1)->buffer == 0
-			|| XMARKER (o1)->bytepos == XMARKER (o2)->bytepos));
+			|| (marker_bytepos (XMARKER (o1))
+			    == marker_bytepos (XMARKER (o2)))));
 
 	  case PVEC_BOOL_VECTOR:
 	    {
@@ -3213,8 +3300,8 @@ value_cmp (Lisp_Object a, Lisp_Object b, int maxdepth)
 		  int cmp = value_cmp (buf_a, buf_b, maxdepth - 1);
 		  if (cmp != 0)
 		    return cmp;
-		  ptrdiff_t pa = XMARKER (a)->charpos;
-		  ptrdiff_t pb = XMARKER (b)->charpos;
+		  ptrdiff_t pa = marker_charpos (XMARKER (a));
+		  ptrdiff_t pb = marker_charpos (XMARKER (b));
 		  return pa < pb ? -1 : pa > pb;
 		}
 
@@ -3347,6 +3434,7 @@ ARRAY is a vector, string, char-table, or bool-vector.  */)
 	      ptrdiff_t product;
 	      if (ckd_mul (&product, size, len) || product != size_byte)
 		error ("Attempt to change byte length of a string");
+	      clear_string_char_byte_cache (array);
 	      for (idx = 0; idx < size_byte; idx++)
 		*p++ = str[idx % len];
 	    }
@@ -5541,7 +5629,8 @@ sxhash_obj (Lisp_Object obj, int depth)
 	else if (pvec_type == PVEC_MARKER)
 	  {
 	    ptrdiff_t bytepos
-	      = XMARKER (obj)->buffer ? XMARKER (obj)->bytepos : 0;
+	      = (XMARKER (obj)->buffer
+		 ? marker_bytepos (XMARKER (obj)) : 0);
 	    EMACS_UINT hash
 	      = sxhash_combine ((intptr_t) XMARKER (obj)->buffer, bytepos);
 	    return hash;
@@ -6096,14 +6185,45 @@ DEFUN ("secure-hash-algorithms", Fsecure_hash_algorithms,
 	       Qsha3_224, Qsha3_256, Qsha3_384, Qsha3_512);
 }
 
+/* Return true if encoding the ASCII text between byte positions
+   FROM_BYTE and TO_BYTE of the current buffer with CODING_SYSTEM
+   would not change it.  This is the test of the fast path in
+   code_convert_string.  */
+static bool
+ascii_text_encodes_as_is (Lisp_Object coding_system,
+			  ptrdiff_t from_byte, ptrdiff_t to_byte)
+{
+  ptrdiff_t id = CODING_SYSTEM_ID (coding_system);
+  if (id < 0 || NILP (CODING_ATTR_ASCII_COMPAT (CODING_ID_ATTRS (id))))
+    return false;
+  if (EQ (CODING_ID_EOL_TYPE (id), Qunix) || inhibit_eol_conversion)
+    return true;
+
+  /* Look for a newline on both sides of the gap.  */
+  ptrdiff_t gpt_byte = GPT_BYTE;
+  if (from_byte < gpt_byte
+      && memchr (BYTE_POS_ADDR (from_byte), '\n',
+		 min (to_byte, gpt_byte) - from_byte))
+    return false;
+  if (gpt_byte < to_byte)
+    {
+      ptrdiff_t beg = max (from_byte, gpt_byte);
+      if (memchr (BYTE_POS_ADDR (beg), '\n', to_byte - beg))
+	return false;
+    }
+  return true;
+}
+
 /* Extract data from a string or a buffer. SPEC is a list of
 (BUFFER-OR-STRING-OR-SYMBOL START END CODING-SYSTEM NOERROR) which behave as
 specified with `secure-hash' and in Info node
-`(elisp)Format of GnuTLS Cryptography Inputs'.  */
-char *
-extract_data_from_object (Lisp_Object spec,
-                          ptrdiff_t *start_byte,
-                          ptrdiff_t *end_byte)
+`(elisp)Format of GnuTLS Cryptography Inputs'.
+If SHARE_TEXT, and the text of a buffer needs no conversion, return a
+pointer to the buffer text itself instead of copying it.  That pointer
+is valid only until the buffer is modified or its gap moves.  */
+static char *
+extract_data_1 (Lisp_Object spec, ptrdiff_t *start_byte,
+		ptrdiff_t *end_byte, bool share_text)
 {
   Lisp_Object object = XCAR (spec);
 
@@ -6237,15 +6357,43 @@ extract_data_from_object (Lisp_Object spec,
 	    }
 	}
 
-      object = make_buffer_string (b, e, false);
+      ptrdiff_t b_byte = CHAR_TO_BYTE (b), e_byte = CHAR_TO_BYTE (e);
+      if (share_text
+	  && (NILP (BVAR (bp, enable_multibyte_characters))
+	      || (e - b == e_byte - b_byte
+		  && ascii_text_encodes_as_is (coding_system,
+					       b_byte, e_byte))))
+	{
+	  /* Make the text contiguous, moving the gap as little as
+	     possible.  */
+	  if (b < GPT && GPT < e)
+	    {
+	      if (GPT - b < e - GPT)
+		move_gap_both (b, b_byte);
+	      else
+		move_gap_both (e, e_byte);
+	    }
+	  char *text = (char *) BYTE_POS_ADDR (b_byte);
+	  if (!NILP (BVAR (bp, enable_multibyte_characters)))
+	    Vlast_coding_system_used = coding_system;
+	  set_buffer_internal (prev);
+	  specpdl_ptr--;
+	  *start_byte = 0;
+	  *end_byte = e_byte - b_byte;
+	  return text;
+	}
+
+      object = make_buffer_string_both (b, b_byte, e, e_byte, false);
       set_buffer_internal (prev);
       /* Discard the unwind protect for recovering the current
 	 buffer.  */
       specpdl_ptr--;
 
+      /* OBJECT is a new string, so it need not be copied again if
+	 encoding would not change it.  */
       if (STRING_MULTIBYTE (object))
 	object = code_convert_string (object, coding_system,
-				      Qnil, true, false, false);
+				      Qnil, true, true, false);
       *start_byte = 0;
       *end_byte = SBYTES (object);
     }
@@ -6280,6 +6428,14 @@ extract_data_from_object (Lisp_Object spec,
   return SSDATA (object);
 }
 
+char *
+extract_data_from_object (Lisp_Object spec,
+                          ptrdiff_t *start_byte,
+                          ptrdiff_t *end_byte)
+{
+  return extract_data_1 (spec, start_byte, end_byte, false);
+}
+
 
 /* ALGORITHM is a symbol: md5, sha1, sha224 and so on. */
 
@@ -6297,7 +6453,9 @@ secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
 
   Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
 
-  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
+  /* Nothing can change the buffer before the text is hashed, so the
+     hash can be computed from the buffer text itself.  */
+  const char *input = extract_data_1 (spec, &start_byte, &end_byte, true);
 
   if (input == NULL)
     error ("secure_hash: Failed to extract data from object, aborting!");
@@ -6733,6 +6891,46 @@ from the absolute start of the buffer, disregarding the narrowing.  */)
 
   return make_int (count_lines (start_byte, pos_byte) + 1);
 }
+
+DEFUN ("line-number-position", Fline_number_position,
+       Sline_number_position, 1, 2, 0,
+       doc: /* Return the position of the beginning of line number LINE.
+This is the inverse of `line-number-at-pos': lines are counted from 1,
+and if the buffer is narrowed, the first line is the one at the
+beginning of the accessible portion of the buffer, unless the second
+optional argument ABSOLUTE is non-nil.
+
+If LINE is less than 1, return the beginning of the accessible portion
+of the buffer, or of the buffer if ABSOLUTE is non-nil.  If the buffer
+has fewer than LINE lines, return the end of the accessible portion of
+the buffer, or of the buffer if ABSOLUTE is non-nil.
+
+Lines are always separated by newlines, regardless of the value of
+`selective-display'.  */)
+  (Lisp_Object line, Lisp_Object absolute)
+{
+  if (!BUFFER_LIVE_P (current_buffer))
+    error ("Attempt to count lines in a dead buffer");
+
+  CHECK_INTEGER (line);
+  ptrdiff_t start, start_byte, end;
+  if (NILP (absolute))
+    start = BEGV, start_byte = BEGV_BYTE, end = ZV;
+  else
+    start = BEG, start_byte = BEG_BYTE, end = Z;
+
+  EMACS_INT n = (FIXNUMP (line) ? XFIXNUM (line)
+		 : NILP (Fnatnump (line)) ? 0 : MOST_POSITIVE_FIXNUM);
+  if (n <= 1)
+    return make_fixnum (start);
+  /* There is at most one line per character, plus the last line.  */
+  if (n - 1 > end - start)
+    return make_fixnum (end);
+  ptrdiff_t lines = n - 1 + line_index_count (BEG_BYTE, start_byte);
+
+  ptrdiff_t bytepos;
+  return make_fixnum (min (end, line_index_position (lines, &bytepos)));
+}
 
 
 void
@@ -6780,6 +6978,7 @@ syms_of_fns (void)
   defsubr (&Sstring_search);
   defsubr (&Sobject_intervals);
   defsubr (&Sline_number_at_pos);
+  defsubr (&Sline_number_position);
 
   /* Crypto and hashing stuff.  */
   DEFSYM (Qiv_auto, "iv-auto");
@@ -6813,6 +7012,8 @@ compilation.  */);
 
   staticpro (&string_char_byte_cache_string);
   string_char_byte_cache_string = Qnil;
+  staticpro (&string_char_byte_index_string);
+  string_char_byte_index_string = Qnil;
 
   require_nesting_list = Qnil;
   staticpro (&require_nesting_list);
@@ -72,13 +72,23 @@ check_markers (void)
     {
       if (tail->buffer->text != current_buffer->text)
 	emacs_abort ();
-      if (tail->charpos > Z)
+      if (marker_charpos (tail) > Z)
 	emacs_abort ();
-      if (tail->bytepos > Z_BYTE)
+      if (marker_bytepos (tail) > Z_BYTE)
 	emacs_abort ();
-      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (tail->bytepos)))
+      if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (marker_bytepos (tail))))
 	emacs_abort ();
     }
+
+  ptrdiff_t charpos = BEG, bytepos = BEG_BYTE;
+  for (tail = marker_tree_ceiling (current_buffer, BEG); tail;
+       tail = marker_tree_next (tail))
+    {
+      if (marker_charpos (tail) < charpos || marker_bytepos (tail) < bytepos)
+	emacs_abort ();
+      charpos = marker_charpos (tail);
+      bytepos = marker_bytepos (tail);
+    }
 }
 
 #else /* not MARKER_DEBUG */
@@ -231,8 +241,8 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 
       if (BUFFERP (w->contents)
 	  && XBUFFER (w->contents) == current_buffer
-	  && XMARKER (w->old_pointm)->charpos >= from
-	  && XMARKER (w->old_pointm)->charpos <= to)
+	  && marker_charpos (XMARKER (w->old_pointm)) >= from
+	  && marker_charpos (XMARKER (w->old_pointm)) <= to)
 	w->suspend_auto_hscroll = 0;
     }
 }
@@ -249,29 +259,12 @@ void
 adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte)
 {
-  struct Lisp_Marker *m;
-  ptrdiff_t charpos;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      charpos = m->charpos;
-      eassert (charpos <= Z);
-
-      /* If the marker is after the deletion,
-	 relocate by number of chars / bytes deleted.  */
-      if (charpos > to)
-	{
-	  m->charpos -= to - from;
-	  m->bytepos -= to_byte - from_byte;
-	}
-      /* Here's the case where a marker is inside text being deleted.  */
-      else if (charpos > from)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  invalidate_line_index (current_buffer, from);
+  /* The markers after the deletion are relocated by the number of
+     chars / bytes deleted, and those inside the text being deleted
+     move to its beginning.  */
+  marker_tree_delete_gap (current_buffer, from, from_byte, to, to_byte);
   adjust_overlays_for_delete (from, to - from);
 }
 
@@ -288,30 +281,10 @@ static void
 adjust_markers_for_insert (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte, bool before_markers)
 {
-  struct Lisp_Marker *m;
-  ptrdiff_t nchars = to - from;
-  ptrdiff_t nbytes = to_byte - from_byte;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      eassert (m->bytepos >= m->charpos
-	       && m->bytepos - m->charpos <= Z_BYTE - Z);
-
-      if (m->bytepos == from_byte)
-	{
-	  if (m->insertion_type || before_markers)
-	    {
-	      m->bytepos = to_byte;
-	      m->charpos = to;
-	    }
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->bytepos += nbytes;
-	  m->charpos += nchars;
-	}
-    }
+  adjust_line_index_for_insert (from, from_byte, to, to_byte);
+  marker_tree_insert_gap (current_buffer, from, from_byte, to, to_byte,
+			  before_markers);
   adjust_overlays_for_insert (from, to - from, before_markers);
 }
 
@@ -343,11 +316,6 @@ adjust_markers_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
 			    ptrdiff_t old_chars, ptrdiff_t old_bytes,
 			    ptrdiff_t new_chars, ptrdiff_t new_bytes)
 {
-  register struct Lisp_Marker *m;
-  ptrdiff_t prev_to_byte = from_byte + old_bytes;
-  ptrdiff_t diff_chars = new_chars - old_chars;
-  ptrdiff_t diff_bytes = new_bytes - old_bytes;
-
   if (old_chars == 0)
     {
       /* Just an insertion: markers at FROM may need to move or not depending
@@ -361,20 +329,10 @@ adjust_markers_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
     }
 
   adjust_suspend_auto_hscroll (from, from + old_chars);
+  invalidate_line_index (current_buffer, from);
 
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      if (m->bytepos >= prev_to_byte)
-	{
-	  m->charpos += diff_chars;
-	  m->bytepos += diff_bytes;
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  marker_tree_replace (current_buffer, from, from_byte,
+		       old_chars, old_bytes, new_chars, new_bytes);
 
   check_markers ();
 
@@ -415,38 +373,35 @@ adjust_markers_bytepos (ptrdiff_t from, ptrdiff_t from_byte,
 {
   register struct Lisp_Marker *m;
   ptrdiff_t beg = from, begbyte = from_byte;
+  bool unibyte = Z == Z_BYTE || (!to_z && to == to_byte);
 
   adjust_suspend_auto_hscroll (from, to);
+  invalidate_line_index (current_buffer, from);
 
-  if (Z == Z_BYTE || (!to_z && to == to_byte))
+  /* The character positions of the markers do not change, so
+     neither does their order, and the affected markers follow each
+     other in the marker tree.  */
+  for (m = marker_tree_ceiling (current_buffer, from); m;
+       m = marker_tree_next (m))
     {
-      /* Make sure each affected marker's bytepos is equal to
-	 its charpos.  */
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-	{
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    m->bytepos = m->charpos;
-	}
-    }
-  else
-    {
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+      ptrdiff_t charpos = marker_charpos (m);
+      ptrdiff_t bytepos = marker_bytepos (m);
+      if (bytepos <= from_byte)
+	continue;
+      if (!to_z && bytepos > to_byte)
+	break;
+
+      if (unibyte)
+	/* Make sure each affected marker's bytepos is equal to
+	   its charpos.  */
+	marker_tree_move_in_place (m, charpos, charpos);
+      else
 	{
 	  /* Recompute each affected marker's bytepos.  */
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    {
-	      if (m->charpos < beg
-		  && beg - m->charpos > m->charpos - from)
-		{
-		  beg = from;
-		  begbyte = from_byte;
-		}
-	      m->bytepos = count_bytes (beg, begbyte, m->charpos);
-	      beg = m->charpos;
-	      begbyte = m->bytepos;
-	    }
+	  bytepos = count_bytes (beg, begbyte, charpos);
+	  marker_tree_move_in_place (m, charpos, bytepos);
+	  beg = charpos;
+	  begbyte = bytepos;
 	}
     }
 
@@ -1584,50 +1539,82 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
     outgoing_insbytes
       = count_size_as_multibyte (insbeg_ptr, insbytes);
 
-  /* Make sure the gap is somewhere in or next to what we are deleting.  */
-  if (from > GPT)
-    gap_right (from, from_byte);
-  if (to < GPT)
-    gap_left (to, to_byte, 0);
+  /* If the new text takes as many bytes as the old, write it over the
+     old text instead of moving the gap, which takes time proportional
+     to the distance between the gap and FROM.  This needs the old
+     text to be contiguous and the new text not to come from it.  */
+  bool in_place = (outgoing_insbytes == nbytes_del
+		   && !(from_byte < GPT_BYTE && GPT_BYTE < to_byte)
+		   && !(insbuf && insbuf->text == current_buffer->text));
 
   if (! EQ (BVAR (current_buffer, undo_list), Qt))
     deletion = make_buffer_string_both (from, from_byte, to, to_byte, 1);
 
-  GAP_SIZE += nbytes_del;
-  ZV -= nchars_del;
-  Z -= nchars_del;
-  ZV_BYTE -= nbytes_del;
-  Z_BYTE -= nbytes_del;
-  GPT = from;
-  GPT_BYTE = from_byte;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  if (GPT - BEG < BEG_UNCHANGED)
-    BEG_UNCHANGED = GPT - BEG;
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
-
-  if (GAP_SIZE < outgoing_insbytes)
-    make_gap (outgoing_insbytes - GAP_SIZE);
-
-  /* Copy the string text into the buffer, perhaps converting
-     between single-byte and multibyte.  */
-  copy_text (insbeg_ptr, GPT_ADDR, insbytes,
-	     new_is_multibyte,
-	     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
+  if (in_place)
+    {
+      if (from - BEG < BEG_UNCHANGED)
+	BEG_UNCHANGED = from - BEG;
+      if (Z - to < END_UNCHANGED)
+	END_UNCHANGED = Z - to;
+
+      copy_text (insbeg_ptr, BYTE_POS_ADDR (from_byte), insbytes,
+		 new_is_multibyte,
+		 ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
+
+      /* The gap stays where it is, but its character position changes
+	 if it is after the replaced text.  */
+      ZV += inschars - nchars_del;
+      Z += inschars - nchars_del;
+      if (GPT > from)
+	GPT += inschars - nchars_del;
+    }
+  else
+    {
+      /* Make sure the gap is somewhere in or next to what we are
+	 deleting.  */
+      if (from > GPT)
+	gap_right (from, from_byte);
+      if (to < GPT)
+	gap_left (to, to_byte, 0);
+
+      GAP_SIZE += nbytes_del;
+      ZV -= nchars_del;
+      Z -= nchars_del;
+      ZV_BYTE -= nbytes_del;
+      Z_BYTE -= nbytes_del;
+      GPT = from;
+      GPT_BYTE = from_byte;
+      if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+
+      eassert (GPT <= GPT_BYTE);
+
+      if (GPT - BEG < BEG_UNCHANGED)
+	BEG_UNCHANGED = GPT - BEG;
+      if (Z - GPT < END_UNCHANGED)
+	END_UNCHANGED = Z - GPT;
+
+      if (GAP_SIZE < outgoing_insbytes)
+	make_gap (outgoing_insbytes - GAP_SIZE);
+
+      /* Copy the string text into the buffer, perhaps converting
+	 between single-byte and multibyte.  */
+      copy_text (insbeg_ptr, GPT_ADDR, insbytes,
+		 new_is_multibyte,
+		 ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
 #ifdef BYTE_COMBINING_DEBUG
-  /* We have copied text into the gap, but we have not marked
-     it as part of the buffer.  So we can use the old FROM and FROM_BYTE
-     here, for both the previous text and the following text.
-     Meanwhile, GPT_ADDR does point to
-     the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_insbytes, from, from_byte)
-      || count_combining_after (GPT_ADDR, outgoing_insbytes, from, from_byte))
-    emacs_abort ();
+      /* We have copied text into the gap, but we have not marked
+	 it as part of the buffer.  So we can use the old FROM and
+	 FROM_BYTE here, for both the previous text and the following
+	 text.  Meanwhile, GPT_ADDR does point to
+	 the text that has been stored by copy_text.  */
+      if (count_combining_before (GPT_ADDR, outgoing_insbytes,
+				  from, from_byte)
+	  || count_combining_after (GPT_ADDR, outgoing_insbytes,
+				    from, from_byte))
+	emacs_abort ();
 #endif
+    }
 
   /* Record the insertion first, so that when we undo,
      the deletion will be undone first.  Thus, undo
@@ -1639,14 +1626,17 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
       record_delete (from, deletion, false);
     }
 
-  GAP_SIZE -= outgoing_insbytes;
-  GPT += inschars;
-  ZV += inschars;
-  Z += inschars;
-  GPT_BYTE += outgoing_insbytes;
-  ZV_BYTE += outgoing_insbytes;
-  Z_BYTE += outgoing_insbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+  if (!in_place)
+    {
+      GAP_SIZE -= outgoing_insbytes;
+      GPT += inschars;
+      ZV += inschars;
+      Z += inschars;
+      GPT_BYTE += outgoing_insbytes;
+      ZV_BYTE += outgoing_insbytes;
+      Z_BYTE += outgoing_insbytes;
+      if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+    }
 
   eassert (GPT <= GPT_BYTE);
 
@@ -1692,8 +1682,8 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
 
   if (run_mod_hooks)
     {
-      signal_after_change (from, nchars_del, GPT - from);
-      update_compositions (from, GPT, CHECK_BORDER);
+      signal_after_change (from, nchars_del, inschars);
+      update_compositions (from, from + inschars, CHECK_BORDER);
     }
 }
 
@@ -2252,6 +2242,10 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  /* Insertions update the line index as they adjust markers, so only
+     changes to existing text need to invalidate it.  */
+  if (start < end)
+    invalidate_line_index (buf, start);
 }
 
 /* These macros work with an argument named `preserve_ptr'
@@ -2384,6 +2378,11 @@ signal_after_change (ptrdiff_t charpos, ptrdiff_t lendel, ptrdiff_t lenins)
   struct rvoe_arg rvoe_arg;
   Lisp_Object tmp, save_insert_behind_hooks, save_insert_in_from_hooks;
 
+  /* Text changed in place may have been scanned into the line index
+     while it was being changed, e.g. by subst-char-in-region.  */
+  if (lendel > 0)
+    invalidate_line_index (current_buffer, charpos);
+
   if (inhibit_modification_hooks)
     return;
 
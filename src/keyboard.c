@@ -2979,9 +2979,18 @@ read_char (int commandflag, Lisp_Object map,
 	    }
 	}
 
-      /* If there is still no input available, ask for GC.  */
-      if (!detect_input_pending_run_timers (0))
+      /* If there is still no input available, ask for GC.  Collect
+	 early if the user asked for that, since a collection now is
+	 less disruptive than one in the middle of the next command.  */
+      if (!detect_input_pending_run_timers (0)
+	  && !(FIXNATP (Vgc_idle_factor)
+	       && maybe_garbage_collect_eagerly (XFIXNAT (Vgc_idle_factor))))
 	maybe_gc ();
+
+      /* Finish the sweeping left over by the last collection while
+	 nothing else is going on.  */
+      if (!detect_input_pending ())
+	finish_lazy_sweep ();
     }
 
   /* Notify the caller if an autosave hook, or a timer, sentinel or
@@ -4874,6 +4883,13 @@ timer_check_2 (Lisp_Object timers, Lisp_Object idle_timers)
 
 	      specbind (Qinhibit_quit, Qt);
 
+	      if (profiler_record_events)
+		{
+		  record_trace_event (TRACE_TIMER, true, NULL);
+		  record_unwind_protect_int (record_trace_event_end,
+					     TRACE_TIMER);
+		}
+
 	      calln (Qtimer_event_handler, chosen_timer);
 	      Vdeactivate_mark = old_deactivate_mark;
 	      timers_run++;
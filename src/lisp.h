@@ -1009,6 +1009,7 @@ enum pvec_type
   PVEC_TS_NODE,
   PVEC_TS_COMPILED_QUERY,
   PVEC_SQLITE,
+  PVEC_COMPILED_REGEXP,
 
   /* These should be last, for internal_equal and sxhash_obj.  */
   PVEC_CLOSURE,
@@ -2839,16 +2840,20 @@ struct Lisp_Marker
      this is used to chain of all the markers in a given buffer.
      The chain does not preserve markers from garbage collection;
      instead, markers are removed from the chain when freed by GC.  */
-  /* We could remove it and use an array in buffer_text instead.
-     That would also allow us to preserve it ordered.  */
   struct Lisp_Marker *next;
-  /* This is the char position where the marker points.  */
-  ptrdiff_t charpos;
-  /* This is the byte position.
-     It's mostly used as a charpos<->bytepos cache (i.e. it's not directly
-     used to implement the functionality of markers, but rather to (ab)use
-     markers as a cache for char<->byte mappings).  */
-  ptrdiff_t bytepos;
+  /* For markers that point somewhere, the links of the tree of the
+     markers in a given buffer, ordered by position.  Like the chain,
+     they do not preserve markers from garbage collection.  */
+  struct Lisp_Marker *parent, *left, *right;
+  /* The char and byte positions where the marker points, relative to
+     those of its parent in the tree, or absolute if the marker is the
+     root of the tree or points nowhere.  Use marker_charpos and
+     marker_bytepos to get the actual positions.  The byte position is
+     mostly used as a charpos<->bytepos cache (i.e. it's not directly
+     used to implement the functionality of markers, but rather to
+     (ab)use markers as a cache for char<->byte mappings).  */
+  ptrdiff_t rel_charpos;
+  ptrdiff_t rel_bytepos;
 } GCALIGNED_STRUCT;
 
 struct Lisp_Overlay
@@ -2922,6 +2927,24 @@ struct Lisp_Sqlite
   bool is_statement;
 } GCALIGNED_STRUCT;
 
+/* A regexp compiled by `regexp-compile'.  */
+struct Lisp_Compiled_Regexp
+{
+  union vectorlike_header header;
+  /* The regexp it was compiled from.  */
+  Lisp_Object pattern;
+  /* The whitespace regexp, syntax table and translation table that
+     CACHE was compiled for, so that garbage collection marks them.  */
+  Lisp_Object whitespace_regexp;
+  Lisp_Object syntax_table;
+  Lisp_Object translate;
+  /* The compiled pattern.  This is NULL until the regexp is first
+     used after loading it from a dump.  */
+  struct regexp_cache *cache;
+  /* The value of regexp_syntax_tick when CACHE was compiled.  */
+  EMACS_UINT syntax_tick;
+} GCALIGNED_STRUCT;
+
 struct Lisp_User_Ptr
 {
   union vectorlike_header header;
@@ -3024,6 +3047,19 @@ XSQLITE (Lisp_Object a)
   return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Sqlite);
 }
 
+INLINE bool
+COMPILED_REGEXP_P (Lisp_Object x)
+{
+  return PSEUDOVECTORP (x, PVEC_COMPILED_REGEXP);
+}
+
+INLINE struct Lisp_Compiled_Regexp *
+XCOMPILED_REGEXP (Lisp_Object a)
+{
+  eassert (COMPILED_REGEXP_P (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Compiled_Regexp);
+}
+
 INLINE bool
 BIGNUMP (Lisp_Object x)
 {
@@ -3864,6 +3900,7 @@ struct handler
   struct bc_frame *act_rec;
   int poll_suppress_count;
   int interrupt_input_blocked;
+  Lisp_Object c_frame;
 
 #ifdef HAVE_X_WINDOWS
   int x_error_handler_depth;
@@ -4477,6 +4514,7 @@ flush_stack_call_func (void (*func) (void *arg), void *arg)
 extern void garbage_collect (void);
 extern void maybe_garbage_collect (void);
 extern bool maybe_garbage_collect_eagerly (EMACS_INT factor);
+extern void finish_lazy_sweep (void);
 extern const char *pending_malloc_warning;
 extern Lisp_Object zero_vector;
 extern EMACS_INT consing_until_gc;
@@ -4860,6 +4898,8 @@ extern void syms_of_eval (void);
 extern void prog_ignore (Lisp_Object);
 extern void mark_specpdl (union specbinding *first, union specbinding *ptr);
 extern void get_backtrace (Lisp_Object *array, ptrdiff_t size);
+extern void get_thread_backtrace (struct thread_state *, Lisp_Object *,
+				  ptrdiff_t);
 Lisp_Object backtrace_top_function (void);
 extern bool let_shadows_buffer_binding_p (struct Lisp_Symbol *symbol);
 void do_debug_on_call (Lisp_Object code, specpdl_ref count);
@@ -4951,11 +4991,27 @@ extern void syms_of_buffer (void);
 
 extern ptrdiff_t marker_position (Lisp_Object);
 extern ptrdiff_t marker_byte_position (Lisp_Object);
+extern ptrdiff_t marker_charpos (const struct Lisp_Marker *);
+extern ptrdiff_t marker_bytepos (const struct Lisp_Marker *);
+extern void marker_tree_remove (struct Lisp_Marker *);
+extern void marker_tree_clear (struct buffer *);
+extern void marker_tree_move_in_place (struct Lisp_Marker *,
+				       ptrdiff_t, ptrdiff_t);
+extern struct Lisp_Marker *marker_tree_ceiling (struct buffer *, ptrdiff_t);
+extern struct Lisp_Marker *marker_tree_next (struct Lisp_Marker *);
+extern void marker_tree_insert_gap (struct buffer *, ptrdiff_t, ptrdiff_t,
+				    ptrdiff_t, ptrdiff_t, bool);
+extern void marker_tree_delete_gap (struct buffer *, ptrdiff_t, ptrdiff_t,
+				    ptrdiff_t, ptrdiff_t);
+extern void marker_tree_replace (struct buffer *, ptrdiff_t, ptrdiff_t,
+				 ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t);
 extern void clear_charpos_cache (struct buffer *);
 extern ptrdiff_t buf_charpos_to_bytepos (struct buffer *, ptrdiff_t);
 extern ptrdiff_t buf_bytepos_to_charpos (struct buffer *, ptrdiff_t);
 extern void detach_marker (Lisp_Object);
 extern void unchain_marker (struct Lisp_Marker *);
+extern void attach_marker (struct Lisp_Marker *, struct buffer *,
+			   ptrdiff_t, ptrdiff_t);
 extern Lisp_Object set_marker_restricted (Lisp_Object, Lisp_Object, Lisp_Object);
 extern Lisp_Object set_marker_both (Lisp_Object, Lisp_Object, ptrdiff_t, ptrdiff_t);
 extern Lisp_Object set_marker_restricted_both (Lisp_Object, Lisp_Object,
@@ -4992,6 +5048,8 @@ extern void syms_of_fileio (void);
 
 /* Defined in search.c.  */
 extern void shrink_regexp_cache (void);
+extern void mark_regexp_cache (void);
+extern void free_compiled_regexp (struct Lisp_Compiled_Regexp *);
 extern void restore_search_regs (void);
 extern void update_search_regs (ptrdiff_t oldstart,
                                 ptrdiff_t oldend, ptrdiff_t newend);
@@ -5041,6 +5099,16 @@ extern ptrdiff_t find_newline_no_quit (ptrdiff_t, ptrdiff_t,
 				       ptrdiff_t, ptrdiff_t *);
 extern ptrdiff_t find_before_next_newline (ptrdiff_t, ptrdiff_t,
 					   ptrdiff_t, ptrdiff_t *);
+struct line_index;
+extern ptrdiff_t line_index_count (ptrdiff_t, ptrdiff_t);
+extern ptrdiff_t line_index_position (ptrdiff_t, ptrdiff_t *);
+extern bool line_index_neighbors (struct buffer *, ptrdiff_t, bool, ptrdiff_t,
+				  ptrdiff_t *, ptrdiff_t *,
+				  ptrdiff_t *, ptrdiff_t *);
+extern void adjust_line_index_for_insert (ptrdiff_t, ptrdiff_t,
+					  ptrdiff_t, ptrdiff_t);
+extern void invalidate_line_index (struct buffer *, ptrdiff_t);
+extern void free_line_index (struct line_index *);
 extern EMACS_INT search_buffer (Lisp_Object, ptrdiff_t, ptrdiff_t,
 				ptrdiff_t, ptrdiff_t, EMACS_INT,
 				bool, Lisp_Object, Lisp_Object, bool);
@@ -5466,6 +5534,14 @@ void syms_of_dbusbind (void);
 /* Defined in profiler.c.  */
 extern bool profiler_memory_running;
 extern void malloc_probe (size_t);
+extern void object_probe (Lisp_Object, size_t);
+enum trace_event_type
+  {
+    TRACE_GC, TRACE_REDISPLAY, TRACE_TIMER, TRACE_PROCESS_FILTER, TRACE_WAIT
+  };
+extern void record_trace_event (enum trace_event_type, bool,
+				EMACS_INT const *);
+extern void record_trace_event_end (int);
 extern void syms_of_profiler (void);
 extern void mark_profiler (void);
 
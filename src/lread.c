@@ -392,8 +392,7 @@ source_marker_get (source_t *src)
 	c = BYTE8_TO_CHAR (c);
       bytepos++;
     }
-  XMARKER (m)->bytepos = bytepos;
-  XMARKER (m)->charpos++;
+  attach_marker (XMARKER (m), b, marker_charpos (XMARKER (m)) + 1, bytepos);
   return c;
 }
 
@@ -402,10 +401,9 @@ source_marker_unget (source_t *src, int c)
 {
   Lisp_Object m = src->object;
   struct buffer *b = XMARKER (m)->buffer;
-  ptrdiff_t bytepos = XMARKER (m)->bytepos;
-  XMARKER (m)->charpos--;
+  ptrdiff_t bytepos = marker_bytepos (XMARKER (m));
   bytepos -= src->multibyte ? buf_prev_char_len (b, bytepos) : 1;
-  XMARKER (m)->bytepos = bytepos;
+  attach_marker (XMARKER (m), b, marker_charpos (XMARKER (m)) - 1, bytepos);
 }
 
 static int
@@ -2174,6 +2172,8 @@ readevalloop (Lisp_Object readcharfun,
   /* True on the first time around.  */
   bool first_sexp = 1;
   Lisp_Object macroexpand;
+  /* Marker recording where to resume reading, if reading a region.  */
+  Lisp_Object point_marker = Qnil;
 
   if (!NILP (sourcename))
     CHECK_STRING (sourcename);
@@ -2326,7 +2326,18 @@ readevalloop (Lisp_Object readcharfun,
 	read_objects_completed = Qnil;
 
       if (!NILP (start) && continue_reading_p)
-	start = Fpoint_marker ();
+	{
+	  /* Reuse the marker made on the previous cycle instead of
+	     making a new one for each form; otherwise evaluating a
+	     large buffer leaves thousands of markers on its chain
+	     until the next GC, and each of them slows down every
+	     insertion and deletion in that buffer.  */
+	  if (MARKERP (point_marker))
+	    set_marker_both (point_marker, Qnil, PT, PT_BYTE);
+	  else
+	    point_marker = Fpoint_marker ();
+	  start = point_marker;
+	}
 
       /* Restore saved point and BEGV.  */
       unbind_to (count1, Qnil);
@@ -2349,6 +2360,9 @@ readevalloop (Lisp_Object readcharfun,
       first_sexp = 0;
     }
 
+  if (MARKERP (point_marker))
+    detach_marker (point_marker);
+
   build_load_history (sourcename,
 		      infile0 || whole_buffer);
 
@@ -81,6 +81,432 @@ clear_charpos_cache (struct buffer *b)
   if (cached_buffer == b)
     cached_buffer = 0;
 }
+
+/* The tree of markers.
+
+   Besides being on the chain of its buffer, each marker that points
+   somewhere is a node of a tree of the markers of the buffer text,
+   ordered by position, so that insertions and deletions of text need
+   not look at every marker after them to adjust their positions.
+
+   The tree is a treap: a binary search tree that is also a heap
+   ordered by a pseudo-random priority of each marker, which keeps its
+   expected depth logarithmic in the number of markers.  Like the
+   intervals of itree.c, the nodes do not store their positions
+   directly.  Each stores its positions relative to those of its
+   parent, and the root stores its absolute positions, so shifting all
+   the markers of a subtree needs only a change to its root.  An
+   insertion or deletion splits the tree into the markers before, in
+   and after the changed text, shifts the last part, and merges the
+   parts again, so it takes time proportional to the depth of the tree
+   and to the number of markers in the changed text.
+
+   Finding the position of a marker takes time proportional to its
+   depth, as it adds up the relative positions of its ancestors.  */
+
+/* Return the priority of M in the heap.  This is a hash of its
+   address, which need not stay the same when the address changes,
+   e.g. when loading a dump, as the priorities only affect the balance
+   of the tree, not its correctness.  */
+
+static uintmax_t
+marker_priority (const struct Lisp_Marker *m)
+{
+  uintmax_t x = (uintptr_t) m;
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9u;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebu;
+  return x ^ (x >> 31);
+}
+
+/* Return the char position of marker M, or its last char position if
+   it points nowhere.  */
+
+ptrdiff_t
+marker_charpos (const struct Lisp_Marker *m)
+{
+  ptrdiff_t charpos = m->rel_charpos;
+  for (m = m->parent; m; m = m->parent)
+    charpos += m->rel_charpos;
+  return charpos;
+}
+
+/* Return the byte position of marker M, or its last byte position if
+   it points nowhere.  */
+
+ptrdiff_t
+marker_bytepos (const struct Lisp_Marker *m)
+{
+  ptrdiff_t bytepos = m->rel_bytepos;
+  for (m = m->parent; m; m = m->parent)
+    bytepos += m->rel_bytepos;
+  return bytepos;
+}
+
+/* Make CHILD, the root of a tree, the child of PARENT at *SLOT.
+   PARENT must be the root of a tree, so that its positions are
+   absolute.  */
+
+static void
+link_marker (struct Lisp_Marker *parent, struct Lisp_Marker **slot,
+	     struct Lisp_Marker *child)
+{
+  *slot = child;
+  if (child)
+    {
+      child->parent = parent;
+      child->rel_charpos -= parent->rel_charpos;
+      child->rel_bytepos -= parent->rel_bytepos;
+    }
+}
+
+/* Make CHILD, a child of PARENT, the root of a tree of its own, and
+   return it.  PARENT must be the root of a tree.  The link from PARENT
+   to CHILD is left alone.  */
+
+static struct Lisp_Marker *
+unlink_marker (struct Lisp_Marker *parent, struct Lisp_Marker *child)
+{
+  if (child)
+    {
+      child->parent = NULL;
+      child->rel_charpos += parent->rel_charpos;
+      child->rel_bytepos += parent->rel_bytepos;
+    }
+  return child;
+}
+
+/* Split the tree whose root is T into *BEFORE, which has the markers
+   before CHARPOS, and *AFTER, which has the others.  If AT_BEFORE, put
+   the markers at CHARPOS into *BEFORE instead.  */
+
+static void
+split_markers (struct Lisp_Marker *t, ptrdiff_t charpos, bool at_before,
+	       struct Lisp_Marker **before, struct Lisp_Marker **after)
+{
+  if (!t)
+    *before = *after = NULL;
+  else if (at_before ? t->rel_charpos <= charpos : t->rel_charpos < charpos)
+    {
+      struct Lisp_Marker *right;
+      split_markers (unlink_marker (t, t->right), charpos, at_before,
+		     &right, after);
+      link_marker (t, &t->right, right);
+      *before = t;
+    }
+  else
+    {
+      struct Lisp_Marker *left;
+      split_markers (unlink_marker (t, t->left), charpos, at_before,
+		     before, &left);
+      link_marker (t, &t->left, left);
+      *after = t;
+    }
+}
+
+/* Merge the trees whose roots are A and B, where no marker of A is
+   after a marker of B, and return the root of the result.  */
+
+static struct Lisp_Marker *
+merge_markers (struct Lisp_Marker *a, struct Lisp_Marker *b)
+{
+  if (!a)
+    return b;
+  if (!b)
+    return a;
+  if (marker_priority (a) > marker_priority (b))
+    {
+      link_marker (a, &a->right,
+		   merge_markers (unlink_marker (a, a->right), b));
+      return a;
+    }
+  else
+    {
+      link_marker (b, &b->left,
+		   merge_markers (a, unlink_marker (b, b->left)));
+      return b;
+    }
+}
+
+/* Move all the markers of the tree whose root is T by CHARS
+   characters and BYTES bytes.  */
+
+static void
+shift_markers (struct Lisp_Marker *t, ptrdiff_t chars, ptrdiff_t bytes)
+{
+  if (t)
+    {
+      t->rel_charpos += chars;
+      t->rel_bytepos += bytes;
+    }
+}
+
+/* Set the relative positions of all the markers of the tree whose
+   root is T to zero.  */
+
+static void
+clear_marker_offsets (struct Lisp_Marker *t)
+{
+  for (; t; t = t->right)
+    {
+      t->rel_charpos = t->rel_bytepos = 0;
+      clear_marker_offsets (t->left);
+    }
+}
+
+/* Move all the markers of the tree whose root is T to CHARPOS and
+   BYTEPOS.  */
+
+static void
+collapse_markers (struct Lisp_Marker *t, ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  if (t)
+    {
+      clear_marker_offsets (t);
+      t->rel_charpos = charpos;
+      t->rel_bytepos = bytepos;
+    }
+}
+
+/* Put the marker M, which is in no tree, into the tree of B at CHARPOS
+   and BYTEPOS.  */
+
+static void
+marker_tree_insert (struct buffer *b, struct Lisp_Marker *m,
+		    ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  struct Lisp_Marker *before, *after;
+  m->parent = m->left = m->right = NULL;
+  m->rel_charpos = charpos;
+  m->rel_bytepos = bytepos;
+  split_markers (BUF_MARKER_TREE (b), charpos, true, &before, &after);
+  BUF_MARKER_TREE (b) = merge_markers (merge_markers (before, m), after);
+}
+
+/* Remove the marker M from the tree of its buffer, leaving its
+   absolute positions in it.  */
+
+void
+marker_tree_remove (struct Lisp_Marker *m)
+{
+  struct Lisp_Marker *parent = m->parent;
+  ptrdiff_t charpos = marker_charpos (m);
+  ptrdiff_t bytepos = marker_bytepos (m);
+  ptrdiff_t parent_charpos = charpos - m->rel_charpos;
+  ptrdiff_t parent_bytepos = bytepos - m->rel_bytepos;
+
+  m->rel_charpos = charpos;
+  m->rel_bytepos = bytepos;
+  struct Lisp_Marker *t = merge_markers (unlink_marker (m, m->left),
+					 unlink_marker (m, m->right));
+  if (t)
+    {
+      t->parent = parent;
+      if (parent)
+	{
+	  t->rel_charpos -= parent_charpos;
+	  t->rel_bytepos -= parent_bytepos;
+	}
+    }
+  if (!parent)
+    BUF_MARKER_TREE (m->buffer) = t;
+  else if (parent->left == m)
+    parent->left = t;
+  else
+    parent->right = t;
+  m->parent = m->left = m->right = NULL;
+}
+
+static void
+marker_tree_clear_1 (struct Lisp_Marker *t,
+		     ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  while (t)
+    {
+      struct Lisp_Marker *right = t->right;
+      charpos = t->rel_charpos += charpos;
+      bytepos = t->rel_bytepos += bytepos;
+      marker_tree_clear_1 (t->left, charpos, bytepos);
+      t->parent = t->left = t->right = NULL;
+      t = right;
+    }
+}
+
+/* Remove all the markers of B from its tree, leaving their absolute
+   positions in them.  */
+
+void
+marker_tree_clear (struct buffer *b)
+{
+  marker_tree_clear_1 (BUF_MARKER_TREE (b), 0, 0);
+  BUF_MARKER_TREE (b) = NULL;
+}
+
+/* Move the marker M to CHARPOS and BYTEPOS without changing the
+   shape of its tree.  The caller must make sure that this does not
+   change the order of the markers.  M need not be reachable from the
+   root of the tree, so that the root can be hidden from
+   buf_charpos_to_bytepos and buf_bytepos_to_charpos while the
+   positions of the markers are inconsistent.  */
+
+void
+marker_tree_move_in_place (struct Lisp_Marker *m,
+			   ptrdiff_t charpos, ptrdiff_t bytepos)
+{
+  ptrdiff_t chars = charpos - marker_charpos (m);
+  ptrdiff_t bytes = bytepos - marker_bytepos (m);
+  m->rel_charpos += chars;
+  m->rel_bytepos += bytes;
+  shift_markers (m->left, -chars, -bytes);
+  shift_markers (m->right, -chars, -bytes);
+}
+
+/* Return the first marker of B, in order of position, that is at or
+   after CHARPOS, or NULL if there is none.  */
+
+struct Lisp_Marker *
+marker_tree_ceiling (struct buffer *b, ptrdiff_t charpos)
+{
+  struct Lisp_Marker *found = NULL;
+  ptrdiff_t base = 0;
+  for (struct Lisp_Marker *t = BUF_MARKER_TREE (b); t; )
+    {
+      base += t->rel_charpos;
+      if (base >= charpos)
+	{
+	  found = t;
+	  t = t->left;
+	}
+      else
+	t = t->right;
+    }
+  return found;
+}
+
+/* Return the marker that follows M in order of position, or NULL if
+   there is none.  */
+
+struct Lisp_Marker *
+marker_tree_next (struct Lisp_Marker *m)
+{
+  if (m->right)
+    {
+      for (m = m->right; m->left; m = m->left)
+	continue;
+      return m;
+    }
+  while (m->parent && m->parent->right == m)
+    m = m->parent;
+  return m->parent;
+}
+
+/* Return the marker that precedes M in order of position, or NULL if
+   there is none.  */
+
+static struct Lisp_Marker *
+marker_tree_prev (struct Lisp_Marker *m)
+{
+  if (m->left)
+    {
+      for (m = m->left; m->right; m = m->right)
+	continue;
+      return m;
+    }
+  while (m->parent && m->parent->left == m)
+    m = m->parent;
+  return m->parent;
+}
+
+/* Move the markers of B that are at the insertion point FROM and
+   FROM_BYTE of the tree whose root is T to *STAY or to *ADVANCE,
+   depending on whether they stay before the inserted text or advance
+   to its end, TO and TO_BYTE.  */
+
+static void
+partition_markers (struct Lisp_Marker *t, ptrdiff_t from,
+		   ptrdiff_t from_byte, ptrdiff_t to, ptrdiff_t to_byte,
+		   struct Lisp_Marker **stay, struct Lisp_Marker **advance)
+{
+  while (t)
+    {
+      struct Lisp_Marker *right = t->right;
+      partition_markers (t->left, from, from_byte, to, to_byte,
+			 stay, advance);
+      t->parent = t->left = t->right = NULL;
+      if (t->insertion_type)
+	{
+	  t->rel_charpos = to;
+	  t->rel_bytepos = to_byte;
+	  *advance = merge_markers (*advance, t);
+	}
+      else
+	{
+	  t->rel_charpos = from;
+	  t->rel_bytepos = from_byte;
+	  *stay = merge_markers (*stay, t);
+	}
+      t = right;
+    }
+}
+
+/* Adjust the markers of B for an insertion that stretches from FROM
+   and FROM_BYTE to TO and TO_BYTE.  The markers at FROM advance to TO
+   if their insertion type is t or BEFORE_MARKERS is true.  */
+
+void
+marker_tree_insert_gap (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+			ptrdiff_t to, ptrdiff_t to_byte, bool before_markers)
+{
+  struct Lisp_Marker *before, *at, *after;
+  split_markers (BUF_MARKER_TREE (b), from, false, &before, &after);
+  split_markers (after, from, true, &at, &after);
+  shift_markers (after, to - from, to_byte - from_byte);
+  if (before_markers)
+    shift_markers (at, to - from, to_byte - from_byte);
+  else if (at)
+    {
+      struct Lisp_Marker *stay = NULL, *advance = NULL;
+      partition_markers (at, from, from_byte, to, to_byte, &stay, &advance);
+      at = merge_markers (stay, advance);
+    }
+  BUF_MARKER_TREE (b) = merge_markers (merge_markers (before, at), after);
+}
+
+/* Adjust the markers of B for the deletion of the text from FROM and
+   FROM_BYTE to TO and TO_BYTE.  */
+
+void
+marker_tree_delete_gap (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+			ptrdiff_t to, ptrdiff_t to_byte)
+{
+  struct Lisp_Marker *before, *deleted, *after;
+  split_markers (BUF_MARKER_TREE (b), from, true, &before, &after);
+  split_markers (after, to, true, &deleted, &after);
+  collapse_markers (deleted, from, from_byte);
+  shift_markers (after, from - to, from_byte - to_byte);
+  BUF_MARKER_TREE (b) = merge_markers (merge_markers (before, deleted),
+				       after);
+}
+
+/* Adjust the markers of B for the replacement of OLD_CHARS characters
+   and OLD_BYTES bytes at FROM and FROM_BYTE with NEW_CHARS characters
+   and NEW_BYTES bytes.  The markers inside the old text move to FROM,
+   and those at its end or after it keep their distance to its end.  */
+
+void
+marker_tree_replace (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+		     ptrdiff_t old_chars, ptrdiff_t old_bytes,
+		     ptrdiff_t new_chars, ptrdiff_t new_bytes)
+{
+  struct Lisp_Marker *before, *replaced, *after;
+  split_markers (BUF_MARKER_TREE (b), from, true, &before, &after);
+  split_markers (after, from + old_chars, false, &replaced, &after);
+  collapse_markers (replaced, from, from_byte);
+  shift_markers (after, new_chars - old_chars, new_bytes - old_bytes);
+  BUF_MARKER_TREE (b) = merge_markers (merge_markers (before, replaced),
+				       after);
+}
 
 /* Converting between character positions and byte positions.  */
 
@@ -139,37 +565,26 @@ CHECK_MARKER (Lisp_Object x)
   CHECK_TYPE (MARKERP (x), Qmarkerp, x);
 }
 
-/* When converting bytes from/to chars, we look through the list of
-   markers to try and find a good starting point (since markers keep
-   track of both bytepos and charpos at the same time).
-   But if there are many markers, it can take too much time to find a "good"
-   marker from which to start.  Worse yet: if it takes a long time and we end
-   up finding a nearby markers, we won't add a new marker to cache this
-   result, so next time around we'll have to go through this same long list
-   to (re)find this best marker.  So the further down the list of
-   markers we go, the less demanding we are w.r.t what is a good marker.
-
-   The previous code used INITIAL=50 and INCREMENT=0 and this lead to
-   really poor performance when there are many markers.
-   I haven't tried to tweak INITIAL, but experiments on my trusty Thinkpad
-   T61 using various artificial test cases seem to suggest that INCREMENT=50
-   might be "the best compromise": it significantly improved the
-   worst case and it was rarely slower and never by much.
-
-   The asymptotic behavior is still poor, tho, so in largish buffers with many
-   overlays (e.g. 300KB and 30K overlays), it can still be a bottleneck.  */
-#define BYTECHAR_DISTANCE_INITIAL 50
-#define BYTECHAR_DISTANCE_INCREMENT 50
+/* When converting bytes from/to chars, we also consider the markers
+   nearest to the position (since markers keep track of both bytepos
+   and charpos at the same time).  They are on the path from the root
+   of the marker tree to where a marker at the position would be.  */
+
+/* Positions farther than this from PT, GPT, BEGV, ZV and the cached
+   position are looked up in the line index (see search.c), which
+   records the character and byte positions of checkpoints a few
+   kilobytes apart.  This is much faster than looking through many
+   markers, and when the index covers a position there is no need to
+   create a marker to remember it.  */
+#define BYTECHAR_INDEX_DISTANCE 5000
 
 /* Return the byte position corresponding to CHARPOS in B.  */
 
 ptrdiff_t
 buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 {
-  struct Lisp_Marker *tail;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG (b) <= charpos && charpos <= BUF_Z (b));
 
@@ -202,15 +617,30 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_charpos, cached_bytepos);
 
-  for (tail = BUF_MARKERS (b);
-       /* If we are down to a range of DISTANCE chars,
-          don't bother checking any other markers;
-          scan the intervening chars directly now.  */
-       tail && !(best_above - charpos < distance
-		 || charpos - best_below < distance);
-       tail = tail->next,
-       distance += BYTECHAR_DISTANCE_INCREMENT)
-    CONSIDER (tail->charpos, tail->bytepos);
+  /* If CHARPOS is far from all of these, use the checkpoints of the
+     line index, extending it unless that means scanning much more
+     text than we would scan anyway.  */
+  bool indexed = false;
+  if (charpos - best_below > BYTECHAR_INDEX_DISTANCE
+      && best_above - charpos > BYTECHAR_INDEX_DISTANCE)
+    {
+      ptrdiff_t below, below_byte, above, above_byte;
+      indexed = line_index_neighbors (b, charpos, false,
+				      2 * (charpos - best_below),
+				      &below, &below_byte,
+				      &above, &above_byte);
+      CONSIDER (below, below_byte);
+      CONSIDER (above, above_byte);
+    }
+
+  ptrdiff_t tail_charpos = 0, tail_bytepos = 0;
+  for (struct Lisp_Marker *tail = BUF_MARKER_TREE (b); tail;
+       tail = tail_charpos < charpos ? tail->right : tail->left)
+    {
+      tail_charpos += tail->rel_charpos;
+      tail_bytepos += tail->rel_bytepos;
+      CONSIDER (tail_charpos, tail_bytepos);
+    }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -219,7 +649,7 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
   eassert (best_below <= charpos && charpos <= best_above);
   if (charpos - best_below < best_above - charpos)
     {
-      bool record = charpos - best_below > 5000;
+      bool record = !indexed && charpos - best_below > 5000;
 
       while (best_below < charpos)
 	{
@@ -244,7 +674,7 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
     }
   else
     {
-      bool record = best_above - charpos > 5000;
+      bool record = !indexed && best_above - charpos > 5000;
 
       while (best_above > charpos)
 	{
@@ -319,10 +749,8 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 ptrdiff_t
 buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 {
-  struct Lisp_Marker *tail;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG_BYTE (b) <= bytepos && bytepos <= BUF_Z_BYTE (b));
 
@@ -350,15 +778,29 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_bytepos, cached_charpos);
 
-  for (tail = BUF_MARKERS (b);
-       /* If we are down to a range of DISTANCE bytes,
-          don't bother checking any other markers;
-          scan the intervening chars directly now.  */
-       tail && !(best_above_byte - bytepos < distance
-		 || bytepos - best_below_byte < distance);
-       tail = tail->next,
-       distance += BYTECHAR_DISTANCE_INCREMENT)
-    CONSIDER (tail->bytepos, tail->charpos);
+  /* If BYTEPOS is far from all of these, use the checkpoints of the
+     line index, like buf_charpos_to_bytepos does.  */
+  bool indexed = false;
+  if (bytepos - best_below_byte > BYTECHAR_INDEX_DISTANCE
+      && best_above_byte - bytepos > BYTECHAR_INDEX_DISTANCE)
+    {
+      ptrdiff_t below, below_byte, above, above_byte;
+      indexed = line_index_neighbors (b, bytepos, true,
+				      2 * (bytepos - best_below_byte),
+				      &below, &below_byte,
+				      &above, &above_byte);
+      CONSIDER (below_byte, below);
+      CONSIDER (above_byte, above);
+    }
+
+  ptrdiff_t tail_charpos = 0, tail_bytepos = 0;
+  for (struct Lisp_Marker *tail = BUF_MARKER_TREE (b); tail;
+       tail = tail_bytepos < bytepos ? tail->right : tail->left)
+    {
+      tail_charpos += tail->rel_charpos;
+      tail_bytepos += tail->rel_bytepos;
+      CONSIDER (tail_bytepos, tail_charpos);
+    }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
@@ -366,7 +808,7 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 
   if (bytepos - best_below_byte < best_above_byte - bytepos)
     {
-      bool record = bytepos - best_below_byte > 5000;
+      bool record = !indexed && bytepos - best_below_byte > 5000;
 
       while (best_below_byte < bytepos)
 	{
@@ -393,7 +835,7 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
     }
   else
     {
-      bool record = best_above_byte - bytepos > 5000;
+      bool record = !indexed && best_above_byte - bytepos > 5000;
 
       while (best_above_byte > bytepos)
 	{
@@ -450,7 +892,7 @@ DEFUN ("marker-position", Fmarker_position, Smarker_position, 1, 1, 0,
 {
   CHECK_MARKER (marker);
   if (XMARKER (marker)->buffer)
-    return make_fixnum (XMARKER (marker)->charpos);
+    return make_fixnum (marker_charpos (XMARKER (marker)));
 
   return Qnil;
 }
@@ -464,12 +906,12 @@ before it was killed.  */)
 {
   CHECK_MARKER (marker);
 
-  return make_fixnum (XMARKER (marker)->charpos);
+  return make_fixnum (marker_charpos (XMARKER (marker)));
 }
 
 /* Change M so it points to B at CHARPOS and BYTEPOS.  */
 
-static void
+void
 attach_marker (struct Lisp_Marker *m, struct buffer *b,
 	       ptrdiff_t charpos, ptrdiff_t bytepos)
 {
@@ -480,16 +922,28 @@ attach_marker (struct Lisp_Marker *m, struct buffer *b,
   else
     eassert (charpos <= bytepos);
 
-  m->charpos = charpos;
-  m->bytepos = bytepos;
-
-  if (m->buffer != b)
+  if (m->buffer == b)
+    {
+      /* A marker often moves only a little, e.g. when reading from
+	 it, and then it can stay where it is in the tree.  */
+      struct Lisp_Marker *prev = marker_tree_prev (m);
+      struct Lisp_Marker *next = marker_tree_next (m);
+      if ((!prev || marker_charpos (prev) <= charpos)
+	  && (!next || charpos <= marker_charpos (next)))
+	{
+	  marker_tree_move_in_place (m, charpos, bytepos);
+	  return;
+	}
+      marker_tree_remove (m);
+    }
+  else
     {
       unchain_marker (m);
       m->buffer = b;
       m->next = BUF_MARKERS (b);
       BUF_MARKERS (b) = m;
     }
+  marker_tree_insert (b, m, charpos, bytepos);
 }
 
 /* If BUFFER is nil, return current buffer pointer.  Next, check
@@ -528,8 +982,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
   else if (MARKERP (position) && b == XMARKER (position)->buffer
 	   && b == m->buffer)
     {
-      m->bytepos = XMARKER (position)->bytepos;
-      m->charpos = XMARKER (position)->charpos;
+      struct Lisp_Marker *p = XMARKER (position);
+      attach_marker (m, b, marker_charpos (p), marker_bytepos (p));
     }
 
   else
@@ -554,8 +1008,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
 	}
       else if (MARKERP (position))
 	{
-	  charpos = XMARKER (position)->charpos;
-	  bytepos = XMARKER (position)->bytepos;
+	  charpos = marker_charpos (XMARKER (position));
+	  bytepos = marker_bytepos (XMARKER (position));
 	}
       else
 	wrong_type_argument (Qinteger_or_marker_p, position);
@@ -677,8 +1131,8 @@ detach_marker (Lisp_Object marker)
   Fset_marker (marker, Qnil, Qnil);
 }
 
-/* Remove MARKER from the chain of whatever buffer it is in.  Set its
-   buffer NULL.  */
+/* Remove MARKER from the chain and the tree of whatever buffer it is
+   in.  Set its buffer NULL.  */
 
 void
 unchain_marker (register struct Lisp_Marker *marker)
@@ -692,6 +1146,7 @@ unchain_marker (register struct Lisp_Marker *marker)
       /* No dead buffers here.  */
       eassert (BUFFER_LIVE_P (b));
 
+      marker_tree_remove (marker);
       marker->buffer = NULL;
       prev = &BUF_MARKERS (b);
 
@@ -729,9 +1184,10 @@ marker_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG (buf) <= m->charpos && m->charpos <= BUF_Z (buf));
+  ptrdiff_t charpos = marker_charpos (m);
+  eassert (BUF_BEG (buf) <= charpos && charpos <= BUF_Z (buf));
 
-  return m->charpos;
+  return charpos;
 }
 
 /* Return the byte position of marker MARKER, as a C integer.  */
@@ -745,9 +1201,10 @@ marker_byte_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG_BYTE (buf) <= m->bytepos && m->bytepos <= BUF_Z_BYTE (buf));
+  ptrdiff_t bytepos = marker_bytepos (m);
+  eassert (BUF_BEG_BYTE (buf) <= bytepos && bytepos <= BUF_Z_BYTE (buf));
 
-  return m->bytepos;
+  return bytepos;
 }
 
 DEFUN ("copy-marker", Fcopy_marker, Scopy_marker, 0, 2, 0,
@@ -817,9 +1274,10 @@ The list includes markers at BEG and at END.  */)
       iend = clip_to_bounds (BEGV, XFIXNUM (end), ZV);
     }
 
-  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-    if (ibeg <= tail->charpos && tail->charpos <= iend)
-      res = Fcons (make_lisp_ptr (tail, Lisp_Vectorlike), res);
+  for (tail = marker_tree_ceiling (current_buffer, ibeg);
+       tail && marker_charpos (tail) <= iend;
+       tail = marker_tree_next (tail))
+    res = Fcons (make_lisp_ptr (tail, Lisp_Vectorlike), res);
 
   return res;
 }
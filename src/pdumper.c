@@ -2124,7 +2124,7 @@ dump_string (struct dump_context *ctx, const struct Lisp_String *string)
 static dump_off
 dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 {
-#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_642DBAF866)
+#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_38162FC4BC)
 # error "Lisp_Marker changed. See CHECK_STRUCTS comment in config.h."
 #endif
 
@@ -2138,9 +2138,15 @@ dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 			    Lisp_Vectorlike, WEIGHT_NORMAL);
       dump_field_lv_rawptr (ctx, out, marker, &marker->next,
 			    Lisp_Vectorlike, WEIGHT_STRONG);
-      DUMP_FIELD_COPY (out, marker, charpos);
-      DUMP_FIELD_COPY (out, marker, bytepos);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->parent,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->left,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->right,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
     }
+  DUMP_FIELD_COPY (out, marker, rel_charpos);
+  DUMP_FIELD_COPY (out, marker, rel_bytepos);
   return finish_dump_pvec (ctx, &out->header);
 }
 
@@ -2249,6 +2255,28 @@ dump_treesit_compiled_query (struct dump_context *ctx,
 }
 #endif
 
+static dump_off
+dump_compiled_regexp (struct dump_context *ctx,
+		      struct Lisp_Compiled_Regexp *regexp)
+{
+#if CHECK_STRUCTS && !defined (HASH_Lisp_Compiled_Regexp_0D6CC8BDD1)
+# error "Lisp_Compiled_Regexp changed. See CHECK_STRUCTS comment in config.h."
+#endif
+  START_DUMP_PVEC (ctx, &regexp->header, struct Lisp_Compiled_Regexp, out);
+  dump_field_lv (ctx, &out->pattern, regexp, &regexp->pattern, WEIGHT_STRONG);
+  dump_field_lv (ctx, &out->whitespace_regexp, regexp,
+		 &regexp->whitespace_regexp, WEIGHT_NORMAL);
+  dump_field_lv (ctx, &out->syntax_table, regexp, &regexp->syntax_table,
+		 WEIGHT_NORMAL);
+  dump_field_lv (ctx, &out->translate, regexp, &regexp->translate,
+		 WEIGHT_NORMAL);
+  /* This will be compiled again when it is first used after loading
+     the dump.  */
+  out->cache = NULL;
+  out->syntax_tick = 0;
+  return finish_dump_pvec (ctx, &out->header);
+}
+
 struct bignum_reload_info
 {
   dump_off data_location;
@@ -2745,7 +2773,7 @@ dump_obarray (struct dump_context *ctx, Lisp_Object object)
 static dump_off
 dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
 {
-#if CHECK_STRUCTS && !defined HASH_buffer_418DFE6359
+#if CHECK_STRUCTS && !defined HASH_buffer_828878062D
 # error "buffer changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct buffer munged_buffer = *in_buffer;
@@ -2813,6 +2841,8 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
         dump_field_fixup_later (ctx, out, buffer, &buffer->own_text.intervals);
       dump_field_lv_rawptr (ctx, out, buffer, &buffer->own_text.markers,
                             Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, buffer, &buffer->own_text.marker_tree,
+                            Lisp_Vectorlike, WEIGHT_NORMAL);
       DUMP_FIELD_COPY (out, buffer, own_text.inhibit_shrinking);
       DUMP_FIELD_COPY (out, buffer, own_text.redisplay);
     }
@@ -2854,6 +2884,7 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->line_index = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -3001,7 +3032,7 @@ dump_vectorlike (struct dump_context *ctx,
                  Lisp_Object lv,
                  dump_off offset)
 {
-#if CHECK_STRUCTS && !defined HASH_pvec_type_99104541E2
+#if CHECK_STRUCTS && !defined HASH_pvec_type_75455AB852
 # error "pvec_type changed. See CHECK_STRUCTS comment in config.h."
 #endif
   const struct Lisp_Vector *v = XVECTOR (lv);
@@ -3047,6 +3078,8 @@ dump_vectorlike (struct dump_context *ctx,
       return dump_finalizer (ctx, XFINALIZER (lv));
     case PVEC_BIGNUM:
       return dump_bignum (ctx, lv);
+    case PVEC_COMPILED_REGEXP:
+      return dump_compiled_regexp (ctx, XCOMPILED_REGEXP (lv));
     case PVEC_NATIVE_COMP_UNIT:
 #ifdef HAVE_NATIVE_COMP
       return dump_native_comp_unit (ctx, XNATIVE_COMP_UNIT (lv));
@@ -2123,6 +2123,12 @@ print_vectorlike_unreadable (Lisp_Object obj, Lisp_Object printcharfun,
       }
       return;
 
+    case PVEC_COMPILED_REGEXP:
+      print_c_string ("#<compiled-regexp ", printcharfun);
+      print_object (XCOMPILED_REGEXP (obj)->pattern, printcharfun, escapeflag);
+      printchar ('>', printcharfun);
+      return;
+
     case PVEC_OBARRAY:
       {
 	struct Lisp_Obarray *o = XOBARRAY (obj);
@@ -5795,6 +5795,15 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	    timeout = short_timeout;
 #endif
 
+	  if (profiler_record_events)
+	    {
+	      EMACS_INT timeout_us;
+	      if (ckd_mul (&timeout_us, timeout.tv_sec, 1000000)
+		  || ckd_add (&timeout_us, timeout_us, timeout.tv_nsec / 1000))
+		timeout_us = -1;
+	      record_trace_event (TRACE_WAIT, true, &timeout_us);
+	    }
+
 	  /* Android requires using a replacement for pselect in
 	     android.c to poll for events.  */
 #if defined HAVE_ANDROID && !defined ANDROID_STUBIFY
@@ -5829,6 +5838,9 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 #endif	/* !HAVE_GLIB */
 #endif /* HAVE_ANDROID && !ANDROID_STUBIFY */
 
+	  if (profiler_record_events)
+	    record_trace_event (TRACE_WAIT, false, NULL);
+
 #ifdef HAVE_GNUTLS
 	  /* Merge tls_available into Available. */
 	  if (tls_nfds > 0)
@@ -6532,6 +6544,23 @@ read_and_insert_process_output (struct Lisp_Process *p, char *buf,
 				    before, before_byte, opoint, opoint_byte);
 }
 
+/* If `profiler-record-events' is non-nil, record in the event log
+   that the filter of process P is being called with NBYTES bytes of
+   output, and arrange for the end of the call to be recorded when
+   unwinding.  */
+
+static void
+record_process_filter_event (struct Lisp_Process *p, ptrdiff_t nbytes)
+{
+  if (profiler_record_events)
+    {
+      record_trace_event (TRACE_PROCESS_FILTER, true,
+			  (EMACS_INT []) { p->pid, nbytes });
+      record_unwind_protect_int (record_trace_event_end,
+				 TRACE_PROCESS_FILTER);
+    }
+}
+
 static void
 read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 				    ssize_t nbytes,
@@ -6573,7 +6602,12 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 
   if (fast_read_process_output
       && EQ (p->filter, Qinternal_default_process_filter))
-    read_and_insert_process_output (p, chars, nbytes, coding);
+    {
+      specpdl_ref count = SPECPDL_INDEX ();
+      record_process_filter_event (p, nbytes);
+      read_and_insert_process_output (p, chars, nbytes, coding);
+      unbind_to (count, Qnil);
+    }
   else
     {
       decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
@@ -6582,13 +6616,19 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
       read_process_output_set_last_coding_system (p, coding);
 
       if (SBYTES (text) > 0)
-	/* FIXME: It's wrong to wrap or not based on debug-on-error, and
-	   sometimes it's simply wrong to wrap (e.g. when called from
-	   accept-process-output).  */
-	internal_condition_case_1 (read_process_output_call,
-				   list3 (outstream, make_lisp_proc (p), text),
-				   !NILP (Vdebug_on_error) ? Qnil : Qerror,
-				   read_process_output_error_handler);
+	{
+	  specpdl_ref count = SPECPDL_INDEX ();
+	  record_process_filter_event (p, nbytes);
+	  /* FIXME: It's wrong to wrap or not based on debug-on-error,
+	     and sometimes it's simply wrong to wrap (e.g. when called
+	     from accept-process-output).  */
+	  internal_condition_case_1 (read_process_output_call,
+				     list3 (outstream, make_lisp_proc (p),
+					    text),
+				     !NILP (Vdebug_on_error) ? Qnil : Qerror,
+				     read_process_output_error_handler);
+	  unbind_to (count, Qnil);
+	}
 
     }
 
@@ -18,11 +18,21 @@ You should have received a copy of the GNU General Public License
 along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include <config.h>
+#include <stdio.h>
+#include <unistd.h>
 #include "lisp.h"
 #include "syssignal.h"
 #include "systime.h"
 #include "pdumper.h"
 
+#ifdef PROFILER_PERF_SUPPORT
+# include <errno.h>
+# include <fcntl.h>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+#endif
+
 /* Return A + B, but return the maximum fixnum if the result would overflow.
    Assume A and B are nonnegative and in fixnum range.  */
 
@@ -266,15 +276,32 @@ evict_lower_half (struct profiler_log *plog)
     }
 }
 
-/* Record the current backtrace in LOG.  COUNT is the weight of this
-   current backtrace: interrupt counts for CPU, and the allocation
-   size for memory.  */
+/* Record the backtrace of THREAD in LOG.  COUNT is the weight of this
+   backtrace: interrupt counts for CPU, and the allocation size for
+   memory.  If PSEUDO_FRAME is non-nil, record it as the innermost
+   frame of the backtrace, e.g. to tell which kind of object was being
+   allocated.  If SIZE_CLASS is non-nil, record it as the frame that
+   calls PSEUDO_FRAME.  */
 
 static void
-record_backtrace (struct profiler_log *plog, EMACS_INT count)
+record_backtrace (struct profiler_log *plog, EMACS_INT count,
+		  struct thread_state *thread, Lisp_Object pseudo_frame,
+		  Lisp_Object size_class)
 {
   log_t *log = plog->log;
-  get_backtrace (log->trace, log->depth);
+  Lisp_Object *trace = log->trace;
+  ptrdiff_t depth = log->depth;
+  if (!NILP (pseudo_frame) && depth > 0)
+    {
+      *trace++ = pseudo_frame;
+      depth--;
+    }
+  if (!NILP (size_class) && depth > 0)
+    {
+      *trace++ = size_class;
+      depth--;
+    }
+  get_thread_backtrace (thread, trace, depth);
   EMACS_UINT hash = trace_hash (log->trace, log->depth);
   int hidx = log_hash_index (log, hash);
   int idx = log->index[hidx];
@@ -326,7 +353,8 @@ record_backtrace (struct profiler_log *plog, EMACS_INT count)
 /* Signal handler for sampling profiler.  */
 
 static void
-add_sample (struct profiler_log *plog, EMACS_INT count)
+add_sample (struct profiler_log *plog, EMACS_INT count,
+	    Lisp_Object pseudo_frame, Lisp_Object size_class)
 {
   if (BASE_EQ (backtrace_top_function (), QAutomatic_GC)) /* bug#60237 */
     /* Special case the time-count inside GC because the hash-table
@@ -337,7 +365,7 @@ add_sample (struct profiler_log *plog, EMACS_INT count)
        effort.  */
     plog->gc_count = saturated_add (plog->gc_count, count);
   else
-    record_backtrace (plog, count);
+    record_backtrace (plog, count, current_thread, pseudo_frame, size_class);
 }
 
 #ifdef PROFILER_CPU_SUPPORT
@@ -345,11 +373,15 @@ add_sample (struct profiler_log *plog, EMACS_INT count)
 /* The sampling interval specified.  */
 static Lisp_Object profiler_cpu_interval = LISPSYM_INITIALLY (Qnil);
 
+/* Whether the profiler samples elapsed time rather than CPU time.  */
+static bool profiler_cpu_wall_clock;
+
 /* The profiler timer and whether it was properly initialized, if
-   POSIX timers are available.  */
+   POSIX timers are available, and whether it measures elapsed time.  */
 #ifdef HAVE_ITIMERSPEC
 static timer_t profiler_timer;
 static bool profiler_timer_ok;
+static bool profiler_timer_wall_clock;
 #endif
 
 /* Status of sampling profiler.  */
@@ -365,9 +397,45 @@ static enum profiler_cpu_running
 /* Hash-table log of CPU profiler.  */
 static struct profiler_log cpu;
 
+#ifdef PROFILER_PERF_SUPPORT
+/* File descriptor of the hardware performance counter sampled by the
+   perf profiler, or -1 if that profiler is not running.  */
+static int profiler_perf_fd = -1;
+#endif
+
 /* The current sampling interval in nanoseconds.  */
 static EMACS_INT current_sampling_interval;
 
+/* Return the pseudo-frame that tells what the current thread is
+   blocked in, or nil if it is running.  */
+static Lisp_Object
+blocked_pseudo_frame (void)
+{
+  switch (current_thread->blocked)
+    {
+    case BLOCKED_IN_SELECT:
+      return QBlocked_in_select;
+    case BLOCKED_IN_IO:
+      return QBlocked_in_I_O;
+    case BLOCKED_ON_LOCK:
+      return QWaiting_for_lock;
+    default:
+      return current_thread->wait_condvar ? QWaiting_for_lock : Qnil;
+    }
+}
+
+/* Return the pseudo-frame to record as the innermost frame of a CPU
+   profiler sample: what the current thread is blocked in, or else the
+   C code it is running, if that is worth telling apart from the Lisp
+   function that called it.  Such C code is often called without a
+   backtrace entry of its own, e.g. from native-compiled code.  */
+static Lisp_Object
+cpu_pseudo_frame (void)
+{
+  Lisp_Object blocked = blocked_pseudo_frame ();
+  return NILP (blocked) ? current_thread->c_frame : blocked;
+}
+
 static void
 handle_profiler_signal (int signal)
 {
@@ -380,7 +448,18 @@ handle_profiler_signal (int signal)
       count += overruns;
     }
 #endif
-  add_sample (&cpu, count);
+  add_sample (&cpu, count, cpu_pseudo_frame (), Qnil);
+
+  /* A thread waiting for the global lock is never the current thread,
+     so when sampling elapsed time, give each such thread a sample of
+     its own.  */
+  if (profiler_cpu_wall_clock
+      && !BASE_EQ (backtrace_top_function (), QAutomatic_GC))
+    for (struct thread_state *thread = all_threads; thread;
+	 thread = thread->next_thread)
+      if (thread != current_thread && thread->m_specpdl
+	  && thread->blocked == BLOCKED_ON_LOCK)
+	record_backtrace (&cpu, count, thread, QWaiting_for_lock, Qnil);
 }
 
 static void
@@ -390,7 +469,7 @@ deliver_profiler_signal (int signal)
 }
 
 static int
-setup_cpu_timer (Lisp_Object sampling_interval)
+setup_cpu_timer (Lisp_Object sampling_interval, bool wall_clock)
 {
   EMACS_INT billion = 1000000000;
 
@@ -409,10 +488,16 @@ setup_cpu_timer (Lisp_Object sampling_interval)
   sigaction (SIGPROF, &action, 0);
 
 #ifdef HAVE_ITIMERSPEC
+  if (profiler_timer_ok && profiler_timer_wall_clock != wall_clock)
+    {
+      timer_delete (profiler_timer);
+      profiler_timer_ok = false;
+    }
+
   if (! profiler_timer_ok)
     {
       /* System clocks to try, in decreasing order of desirability.  */
-      static clockid_t const system_clock[] = {
+      static clockid_t const cpu_time_clocks[] = {
 #ifdef CLOCK_THREAD_CPUTIME_ID
 	CLOCK_THREAD_CPUTIME_ID,
 #endif
@@ -424,15 +509,27 @@ setup_cpu_timer (Lisp_Object sampling_interval)
 #endif
 	CLOCK_REALTIME
       };
+      static clockid_t const elapsed_time_clocks[] = {
+#ifdef CLOCK_MONOTONIC
+	CLOCK_MONOTONIC,
+#endif
+	CLOCK_REALTIME
+      };
+      clockid_t const *system_clock
+	= wall_clock ? elapsed_time_clocks : cpu_time_clocks;
+      int nclocks = (wall_clock
+		     ? countof (elapsed_time_clocks)
+		     : countof (cpu_time_clocks));
       struct sigevent sigev;
       sigev.sigev_value.sival_ptr = &profiler_timer;
       sigev.sigev_signo = SIGPROF;
       sigev.sigev_notify = SIGEV_SIGNAL;
 
-      for (int i = 0; i < countof (system_clock); i++)
+      for (int i = 0; i < nclocks; i++)
 	if (timer_create (system_clock[i], &sigev, &profiler_timer) == 0)
 	  {
 	    profiler_timer_ok = true;
+	    profiler_timer_wall_clock = wall_clock;
 	    break;
 	  }
     }
@@ -447,9 +544,11 @@ setup_cpu_timer (Lisp_Object sampling_interval)
 #endif
 
 #ifdef HAVE_SETITIMER
+  /* ITIMER_REAL would be the elapsed-time timer, but its SIGALRM is
+     taken by atimers.  */
   struct itimerval timer;
   timer.it_value = timer.it_interval = make_timeval (interval);
-  if (setitimer (ITIMER_PROF, &timer, 0) == 0)
+  if (!wall_clock && setitimer (ITIMER_PROF, &timer, 0) == 0)
     return SETITIMER_RUNNING;
 #endif
 
@@ -457,19 +556,40 @@ setup_cpu_timer (Lisp_Object sampling_interval)
 }
 
 DEFUN ("profiler-cpu-start", Fprofiler_cpu_start, Sprofiler_cpu_start,
-       1, 1, 0,
+       1, 2, 0,
        doc: /* Start or restart the cpu profiler.
 It takes call-stack samples each SAMPLING-INTERVAL nanoseconds, approximately.
+
+If WALL-CLOCK is nil, the intervals are measured in CPU time, so time
+Emacs spends waiting is not sampled.  Otherwise, they are measured in
+elapsed time, so it is.  In both cases, samples taken while Emacs waits
+for input or subprocess output, reads or writes a file, or waits for a
+lock have `Blocked in select', `Blocked in I/O' or `Waiting for lock'
+as their innermost frame.  Likewise, samples taken while Emacs matches
+a regexp, scans over lists, or decodes or encodes text have `Regexp
+matching', `Scanning lists', `Decoding' or `Encoding' as their
+innermost frame, even when the primitive that does that was called
+from native-compiled code, which does not record backtrace entries for
+the primitives it calls.
+
+When measuring elapsed time, each thread that waits for its turn to run
+is also sampled, with its own backtrace and `Waiting for lock' as the
+innermost frame.
+
 See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
-  (Lisp_Object sampling_interval)
+  (Lisp_Object sampling_interval, Lisp_Object wall_clock)
 {
   if (profiler_cpu_running)
     error ("CPU profiler is already running");
+#ifdef PROFILER_PERF_SUPPORT
+  if (0 <= profiler_perf_fd)
+    error ("CPU profiler cannot run while the perf profiler is running");
+#endif
 
   if (cpu.log == NULL)
     cpu = make_profiler_log ();
 
-  int status = setup_cpu_timer (sampling_interval);
+  int status = setup_cpu_timer (sampling_interval, !NILP (wall_clock));
   if (status < 0)
     {
       profiler_cpu_running = NOT_RUNNING;
@@ -478,6 +598,7 @@ See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
   else
     {
       profiler_cpu_interval = sampling_interval;
+      profiler_cpu_wall_clock = !NILP (wall_clock);
       profiler_cpu_running = status;
       if (! profiler_cpu_running)
 	error ("Unable to start profiler timer");
@@ -552,12 +673,184 @@ before returning.  */)
   Lisp_Object ret = export_log (&cpu);
 
   if (prof_cpu)
-    Fprofiler_cpu_start (profiler_cpu_interval);
+    Fprofiler_cpu_start (profiler_cpu_interval,
+			 profiler_cpu_wall_clock ? Qt : Qnil);
 
   return ret;
 }
 #endif /* PROFILER_CPU_SUPPORT */
 
+#ifdef PROFILER_PERF_SUPPORT
+
+/* The event and sampling period of the perf profiler.  */
+static Lisp_Object profiler_perf_event = LISPSYM_INITIALLY (Qnil);
+static Lisp_Object profiler_perf_period = LISPSYM_INITIALLY (Qnil);
+
+/* Hash-table log of the perf profiler.  */
+static struct profiler_log perf;
+
+static void
+handle_perf_signal (int signal)
+{
+  int fd = profiler_perf_fd;
+  if (fd < 0)
+    return;
+  add_sample (&perf, 1, cpu_pseudo_frame (), Qnil);
+  /* The counter disables itself after each overflow it signals.  */
+  ioctl (fd, PERF_EVENT_IOC_REFRESH, 1);
+}
+
+static void
+deliver_perf_signal (int signal)
+{
+  deliver_process_signal (signal, handle_perf_signal);
+}
+
+DEFUN ("profiler-perf-start", Fprofiler_perf_start, Sprofiler_perf_start,
+       2, 2, 0,
+       doc: /* Start the hardware performance counter profiler.
+It takes a call-stack sample each time the thread that started it has
+caused PERIOD occurrences of EVENT, which can be one of these symbols:
+
+ `cycles'         CPU cycles.
+ `instructions'   Instructions retired.
+ `cache-misses'   Cache misses, usually of the last-level cache.
+ `branch-misses'  Mispredicted branches.
+
+Only events in Emacs itself are counted, not those in the kernel.
+
+This profiler uses the perf_event_open system call, and signals an
+error if the kernel or the hardware does not support EVENT, or if the
+user is not allowed to monitor it, e.g. because of the setting of the
+`kernel.perf_event_paranoid' sysctl.  It cannot run at the same time as
+the CPU profiler.  The log it records, see `profiler-perf-log', is like
+that of the CPU profiler, so it can be viewed with
+`profiler-report-profile' and a profile of type `cpu'.
+
+See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
+  (Lisp_Object event, Lisp_Object period)
+{
+  if (0 <= profiler_perf_fd)
+    error ("Perf profiler is already running");
+  if (profiler_cpu_running)
+    error ("Perf profiler cannot run while the CPU profiler is running");
+
+  unsigned long long config;
+  if (EQ (event, Qcycles))
+    config = PERF_COUNT_HW_CPU_CYCLES;
+  else if (EQ (event, Qinstructions))
+    config = PERF_COUNT_HW_INSTRUCTIONS;
+  else if (EQ (event, Qcache_misses))
+    config = PERF_COUNT_HW_CACHE_MISSES;
+  else if (EQ (event, Qbranch_misses))
+    config = PERF_COUNT_HW_BRANCH_MISSES;
+  else
+    signal_error ("Unknown performance event", event);
+  if (! RANGED_FIXNUMP (1, period, MOST_POSITIVE_FIXNUM))
+    signal_error ("Invalid sampling period", period);
+
+  struct perf_event_attr attr = {
+    .type = PERF_TYPE_HARDWARE,
+    .size = sizeof attr,
+    .config = config,
+    .sample_period = XFIXNUM (period),
+    .disabled = true,
+    .exclude_kernel = true,
+    .exclude_hv = true,
+  };
+  int fd = syscall (SYS_perf_event_open, &attr, 0, -1, -1,
+		    PERF_FLAG_FD_CLOEXEC);
+  if (fd < 0)
+    report_file_error ("Opening performance counter", event);
+
+  /* Have the counter signal this thread when it overflows.  */
+  struct f_owner_ex owner = { .type = F_OWNER_TID,
+			      .pid = syscall (SYS_gettid) };
+  int flags = fcntl (fd, F_GETFL);
+  if (flags < 0
+      || fcntl (fd, F_SETFL, flags | O_ASYNC) < 0
+      || fcntl (fd, F_SETSIG, SIGPROF) < 0
+      || fcntl (fd, F_SETOWN_EX, &owner) < 0)
+    {
+      int err = errno;
+      emacs_close (fd);
+      report_file_errno ("Setting up performance counter", event, err);
+    }
+
+  if (perf.log == NULL)
+    perf = make_profiler_log ();
+
+  struct sigaction action;
+  emacs_sigaction_init (&action, deliver_perf_signal);
+  sigaction (SIGPROF, &action, 0);
+
+  profiler_perf_fd = fd;
+  profiler_perf_event = event;
+  profiler_perf_period = period;
+  if (ioctl (fd, PERF_EVENT_IOC_REFRESH, 1) < 0)
+    {
+      int err = errno;
+      Fprofiler_perf_stop ();
+      report_file_errno ("Starting performance counter", event, err);
+    }
+
+  return Qt;
+}
+
+DEFUN ("profiler-perf-stop", Fprofiler_perf_stop, Sprofiler_perf_stop,
+       0, 0, 0,
+       doc: /* Stop the perf profiler.  The profiler log is not affected.
+Return non-nil if the profiler was running.  */)
+  (void)
+{
+  int fd = profiler_perf_fd;
+  if (fd < 0)
+    return Qnil;
+
+  profiler_perf_fd = -1;
+  ioctl (fd, PERF_EVENT_IOC_DISABLE, 0);
+  emacs_close (fd);
+  signal (SIGPROF, SIG_IGN);
+  return Qt;
+}
+
+DEFUN ("profiler-perf-running-p",
+       Fprofiler_perf_running_p, Sprofiler_perf_running_p,
+       0, 0, 0,
+       doc: /* Return non-nil if the perf profiler is running.  */)
+  (void)
+{
+  return 0 <= profiler_perf_fd ? Qt : Qnil;
+}
+
+DEFUN ("profiler-perf-log", Fprofiler_perf_log, Sprofiler_perf_log,
+       0, 0, 0,
+       doc: /* Return the current perf profiler log.
+The log is a hash-table mapping backtraces to the number of samples
+taken at those points.  Every backtrace is a vector of functions, where
+the last few elements may be nil.
+
+If the profiler has not run since the last invocation of
+`profiler-perf-log' (or was never run at all), return nil.  If the
+profiler is currently running, allocate a new log for future samples
+before returning.  */)
+  (void)
+{
+  /* Temporarily stop profiling to avoid it interfering with our data
+     access.  */
+  bool prof_perf = 0 <= profiler_perf_fd;
+  if (prof_perf)
+    Fprofiler_perf_stop ();
+
+  Lisp_Object ret = export_log (&perf);
+
+  if (prof_perf)
+    Fprofiler_perf_start (profiler_perf_event, profiler_perf_period);
+
+  return ret;
+}
+#endif /* PROFILER_PERF_SUPPORT */
+
 /* Extract log data to a Lisp hash table.  The log data is then erased.  */
 static Lisp_Object
 export_log (struct profiler_log *plog)
@@ -605,6 +898,12 @@ DEFUN ("profiler-memory-start", Fprofiler_memory_start, Sprofiler_memory_start,
 The memory profiler will take samples of the call-stack whenever a new
 allocation takes place.  Note that most small allocations only trigger
 the profiler occasionally.
+
+Allocations of Lisp objects are sampled once every
+`profiler-memory-sampling-interval' bytes, and the samples are recorded
+with a pseudo-frame naming the kind of object that was allocated, such
+as `conses', `strings' or `markers', as the innermost frame.  The frame
+that calls it names the size class of the object, such as `16-31 bytes'.
 See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
   (void)
 {
@@ -674,7 +973,197 @@ before returning.  */)
 void
 malloc_probe (size_t size)
 {
-  add_sample (&memory, min (size, MOST_POSITIVE_FIXNUM));
+  add_sample (&memory, min (size, MOST_POSITIVE_FIXNUM), Qnil, Qnil);
+}
+
+/* Number of bytes of Lisp objects allocated since the memory profiler
+   last took a sample of an object allocation.  */
+static EMACS_INT object_bytes_since_sample;
+
+/* Number of size classes of sampled Lisp objects.  Objects of class I
+   take from 2**I to 2**(I + 1) - 1 bytes, except that the last class
+   also has all bigger objects.  */
+enum { OBJECT_SIZE_CLASSES = 31 };
+
+/* Vector of the pseudo-frames that name the size classes.  They are
+   made in advance, as making a symbol while sampling would allocate
+   an object of its own.  */
+static Lisp_Object object_size_classes;
+
+/* Record that the current backtrace allocated a Lisp object of kind
+   KIND, taking SIZE bytes.  Only one allocation per
+   `profiler-memory-sampling-interval' bytes is recorded, with the
+   weight of all the bytes allocated since the previous sample, so
+   that the profile stays statistically accurate without walking the
+   backtrace on every allocation.  The sample records KIND and the
+   size class of this object as pseudo-frames.  */
+void
+object_probe (Lisp_Object kind, size_t size)
+{
+  EMACS_INT nbytes = saturated_add (object_bytes_since_sample,
+				    min (size, MOST_POSITIVE_FIXNUM));
+  if (nbytes < profiler_memory_sampling_interval)
+    object_bytes_since_sample = nbytes;
+  else
+    {
+      object_bytes_since_sample = 0;
+      int size_class = min (max (elogb (size), 0), OBJECT_SIZE_CLASSES - 1);
+      add_sample (&memory, nbytes, kind,
+		  AREF (object_size_classes, size_class));
+    }
+}
+
+/* Event log.  */
+
+/* The event log is a flight recorder: a fixed-size ring buffer of
+   timestamped events, such as the start and end of each garbage
+   collection or redisplay, that is cheap enough to be always on.  It
+   is only written to by the thread holding the global lock, and never
+   from signal handlers, so it needs no further synchronization.  */
+
+enum { EVENT_LOG_SIZE = 4096, EVENT_ARGS_MAX = 5 };
+
+struct trace_event
+{
+  struct timespec time;
+  /* The thread the event happened in.  This is only compared with
+     other threads, as the thread may no longer exist.  */
+  struct thread_state const *thread;
+  EMACS_INT args[EVENT_ARGS_MAX];
+  unsigned char type;
+  bool_bf begin : 1;
+  bool_bf has_args : 1;
+};
+
+/* Names of the event types and of their arguments, as shown in the
+   output of `profiler-event-log'.  Only one of the beginning or the
+   end of an event has arguments.  */
+static struct
+{
+  char const *name;
+  char const *args[EVENT_ARGS_MAX];
+} const trace_event_types[] =
+  {
+    [TRACE_GC] = { "garbage-collect",
+		   /* Bytes freed, at the end.  */
+		   { "conses", "floats", "strings", "vectors", "symbols" } },
+    [TRACE_REDISPLAY] = { "redisplay" },
+    [TRACE_TIMER] = { "timer" },
+    [TRACE_PROCESS_FILTER] = { "process-filter", { "pid", "bytes" } },
+    [TRACE_WAIT] = { "wait-for-input", { "timeout-us" } },
+  };
+
+static struct trace_event event_log[EVENT_LOG_SIZE];
+
+/* Number of events recorded since Emacs started.  The most recent
+   EVENT_LOG_SIZE of them are in event_log, the Nth one at index N
+   modulo EVENT_LOG_SIZE.  */
+static EMACS_UINT event_log_count;
+
+/* Record the beginning (if BEGIN) or end of an event of type TYPE in
+   the event log.  ARGS, if non-null, holds the arguments of the event,
+   as many as trace_event_types describes for TYPE.  Callers should
+   check `profiler-record-events' first.  */
+void
+record_trace_event (enum trace_event_type type, bool begin,
+		    EMACS_INT const *args)
+{
+  struct trace_event *e = &event_log[event_log_count++ % EVENT_LOG_SIZE];
+  e->time = current_timespec ();
+  e->thread = current_thread;
+  e->type = type;
+  e->begin = begin;
+  e->has_args = args != NULL;
+  if (args)
+    for (int i = 0;
+	 i < EVENT_ARGS_MAX && trace_event_types[type].args[i]; i++)
+      e->args[i] = args[i];
+}
+
+/* Record the end of an event of type TYPE.  This is meant to be used
+   with record_unwind_protect_int, so that the end of the event is
+   recorded even if it exits nonlocally.  */
+void
+record_trace_event_end (int type)
+{
+  record_trace_event (type, false, NULL);
+}
+
+/* Upper bound on the length of an event in JSON format.  */
+enum
+  {
+    EVENT_JSON_MAX = (128 + INT_STRLEN_BOUND (EMACS_UINT)
+		      + EVENT_ARGS_MAX * (32 + INT_STRLEN_BOUND (EMACS_INT)))
+  };
+
+DEFUN ("profiler-event-log", Fprofiler_event_log, Sprofiler_event_log,
+       0, 0, 0,
+       doc: /* Return the events recorded in the event log, oldest first.
+When `profiler-record-events' is non-nil, Emacs records the beginning
+and end of garbage collections, redisplays, timer runs, process filter
+calls, and waits for input, in a log that holds the most recent 4096
+such events.
+
+The value is a unibyte string in the Trace Event Format used by
+Chrome's and Perfetto's trace viewers.  The timestamps are in
+microseconds since the epoch.  The end of each garbage collection
+records how many bytes of each kind of object it freed, approximately;
+process filter calls record the process ID and the number of bytes
+read; and waits for input record their timeout in microseconds, or -1
+if there is none.  Each thread has a track of its own: the main thread's
+ID is 1, and other threads are numbered from 2 in the order in which
+they first appear in the log.  */)
+  (void)
+{
+  EMACS_UINT count = min (event_log_count, EVENT_LOG_SIZE);
+  USE_SAFE_ALLOCA;
+  char *buf = SAFE_ALLOCA (count * EVENT_JSON_MAX + 64);
+  char *p = buf;
+  intmax_t pid = getpid ();
+  /* The threads other than the main thread seen so far.  Thread number
+     I + 2 is THREADS[I].  */
+  struct thread_state const **threads;
+  SAFE_NALLOCA (threads, 1, count);
+  EMACS_UINT nthreads = 0;
+
+  p += sprintf (p, "{\"traceEvents\":[");
+  for (EMACS_UINT n = event_log_count - count; n < event_log_count; n++)
+    {
+      struct trace_event const *e = &event_log[n % EVENT_LOG_SIZE];
+      intmax_t us = (intmax_t) e->time.tv_sec * 1000000
+		    + e->time.tv_nsec / 1000;
+      EMACS_UINT tid = 1;
+      if (!main_thread_p (e->thread))
+	{
+	  EMACS_UINT i = 0;
+	  while (i < nthreads && threads[i] != e->thread)
+	    i++;
+	  if (i == nthreads)
+	    threads[nthreads++] = e->thread;
+	  tid = i + 2;
+	}
+      p += sprintf (p, ("%s\n{\"name\":\"%s\",\"cat\":\"emacs\","
+			"\"ph\":\"%c\",\"ts\":%"PRIdMAX".%03d,"
+			"\"pid\":%"PRIdMAX",\"tid\":%"pI"u"),
+		    n == event_log_count - count ? "" : ",",
+		    trace_event_types[e->type].name, e->begin ? 'B' : 'E',
+		    us, (int) (e->time.tv_nsec % 1000), pid, tid);
+      if (e->has_args)
+	{
+	  p += sprintf (p, ",\"args\":{");
+	  for (int i = 0;
+	       i < EVENT_ARGS_MAX && trace_event_types[e->type].args[i]; i++)
+	    p += sprintf (p, "%s\"%s\":%"pI"d", i == 0 ? "" : ",",
+			  trace_event_types[e->type].args[i], e->args[i]);
+	  *p++ = '}';
+	}
+      *p++ = '}';
+    }
+  p += sprintf (p, "],\n\"displayTimeUnit\":\"ms\"}\n");
+
+  Lisp_Object result = make_unibyte_string (buf, p - buf);
+  SAFE_FREE ();
+  return result;
 }
 
 DEFUN ("function-equal", Ffunction_equal, Sfunction_equal, 2, 2, 0,
@@ -698,6 +1187,9 @@ mark_profiler (void)
 {
 #ifdef PROFILER_CPU_SUPPORT
   mark_log (cpu.log);
+#endif
+#ifdef PROFILER_PERF_SUPPORT
+  mark_log (perf.log);
 #endif
   mark_log (memory.log);
 }
@@ -713,10 +1205,43 @@ syms_of_profiler (void)
 If the log gets full, some of the least-seen call-stacks will be evicted
 to make room for new entries.  */);
   profiler_log_size = 10000;
+  DEFVAR_INT ("profiler-memory-sampling-interval",
+	      profiler_memory_sampling_interval,
+	      doc: /* Bytes allocated between memory profiler samples.
+When the memory profiler is running, it records the backtrace of one
+Lisp object allocation, such as a call to `cons', every time this many
+bytes worth of objects have been allocated.  Smaller values give more
+precise profiles but slow down allocation more.  */);
+  profiler_memory_sampling_interval = 4096;
+  DEFVAR_BOOL ("profiler-record-events", profiler_record_events,
+	       doc: /* Non-nil means record events in the event log.
+See `profiler-event-log'.  */);
+  profiler_record_events = true;
 
   DEFSYM (QDiscarded_Samples, "Discarded Samples");
+  DEFSYM (QBlocked_in_select, "Blocked in select");
+  DEFSYM (QBlocked_in_I_O, "Blocked in I/O");
+  DEFSYM (QWaiting_for_lock, "Waiting for lock");
+  DEFSYM (QRegexp_matching, "Regexp matching");
+  DEFSYM (QScanning_lists, "Scanning lists");
+  DEFSYM (QDecoding, "Decoding");
+  DEFSYM (QEncoding, "Encoding");
+
+  object_size_classes = make_nil_vector (OBJECT_SIZE_CLASSES);
+  staticpro (&object_size_classes);
+  for (int i = 0; i < OBJECT_SIZE_CLASSES; i++)
+    {
+      char name[sizeof "-+ bytes" + 2 * INT_STRLEN_BOUND (EMACS_INT)];
+      EMACS_INT low = (EMACS_INT) 1 << i;
+      if (i < OBJECT_SIZE_CLASSES - 1)
+	sprintf (name, "%"pI"d-%"pI"d bytes", low, 2 * low - 1);
+      else
+	sprintf (name, "%"pI"d+ bytes", low);
+      ASET (object_size_classes, i, intern (name));
+    }
 
   defsubr (&Sfunction_equal);
+  defsubr (&Sprofiler_event_log);
 
 #ifdef PROFILER_CPU_SUPPORT
   profiler_cpu_running = NOT_RUNNING;
@@ -724,6 +1249,16 @@ to make room for new entries.  */);
   defsubr (&Sprofiler_cpu_stop);
   defsubr (&Sprofiler_cpu_running_p);
   defsubr (&Sprofiler_cpu_log);
+#endif
+#ifdef PROFILER_PERF_SUPPORT
+  DEFSYM (Qcycles, "cycles");
+  DEFSYM (Qinstructions, "instructions");
+  DEFSYM (Qcache_misses, "cache-misses");
+  DEFSYM (Qbranch_misses, "branch-misses");
+  defsubr (&Sprofiler_perf_start);
+  defsubr (&Sprofiler_perf_stop);
+  defsubr (&Sprofiler_perf_running_p);
+  defsubr (&Sprofiler_perf_log);
 #endif
   profiler_memory_running = false;
   defsubr (&Sprofiler_memory_start);
@@ -3378,6 +3378,60 @@ re_search (struct re_pattern_buffer *bufp, const char *string, ptrdiff_t size,
 		      regs, size);
 }
 
+/* If every match of BUFP begins with the same bytes in the text being
+   searched, return the address of those bytes in the pattern and
+   store their number into *LEN.  Otherwise, return NULL.  This
+   ignores translation, so the caller must check that there is none.  */
+
+static re_char *
+literal_prefix (struct re_pattern_buffer *bufp, ptrdiff_t *len)
+{
+  re_char *p = bufp->buffer;
+  re_char *pend = p + bufp->used;
+
+  while (p < pend)
+    switch (*p)
+      {
+      case start_memory:
+	p += 2;
+	break;
+
+	/* These match the empty string, so the match still begins with
+	   whatever comes next.  */
+      case begline:
+      case wordbeg:
+      case wordend:
+      case wordbound:
+      case notwordbound:
+      case symbeg:
+      case symend:
+	p++;
+	break;
+
+      case exactn:
+	{
+	  int n = p[1];
+	  /* If the pattern and the text differ in multibyteness,
+	     only ASCII characters have the same bytes in both.  */
+	  if (RE_MULTIBYTE_P (bufp) != RE_TARGET_MULTIBYTE_P (bufp))
+	    {
+	      int i;
+	      for (i = 0; i < n && ASCII_CHAR_P (p[2 + i]); i++)
+		continue;
+	      n = i;
+	    }
+	  if (n == 0)
+	    return NULL;
+	  *len = n;
+	  return p + 2;
+	}
+
+      default:
+	return NULL;
+      }
+  return NULL;
+}
+
 /* Address of POS in the concatenation of virtual string. */
 #define POS_ADDR_VSTRING(POS)					\
   (((POS) >= size1 ? string2 - size1 : string1) + (POS))
@@ -3403,11 +3457,12 @@ re_search (struct re_pattern_buffer *bufp, const char *string, ptrdiff_t size,
    found, -1 if no match, or -2 if error (such as failure
    stack overflow).  */
 
-ptrdiff_t
-re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
-	     const char *str2, ptrdiff_t size2,
-	     ptrdiff_t startpos, ptrdiff_t range,
-	     struct re_registers *regs, ptrdiff_t stop)
+static ptrdiff_t
+re_search_2_internal (struct re_pattern_buffer *bufp,
+		      const char *str1, ptrdiff_t size1,
+		      const char *str2, ptrdiff_t size2,
+		      ptrdiff_t startpos, ptrdiff_t range,
+		      struct re_registers *regs, ptrdiff_t stop)
 {
   ptrdiff_t val;
   re_char *string1 = (re_char *) str1;
@@ -3458,6 +3513,13 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
   /* See whether the pattern is anchored.  */
   anchored_start = (bufp->buffer[0] == begline);
 
+  /* If all matches begin with the same bytes, a forward search can
+     look for them with memmem instead of testing the fastmap one
+     character at a time.  */
+  ptrdiff_t literal_len = 0;
+  re_char *literal = (range > 0 && NILP (translate)
+		      ? literal_prefix (bufp, &literal_len) : NULL);
+
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, startpos);
 
   /* Loop through the string, looking for a place to start matching.  */
@@ -3493,6 +3555,27 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	      if (startpos < size1 && startpos + range >= size1)
 		lim = range - (size1 - startpos);
 
+	      if (literal)
+		{
+		  /* Skip to the next occurrence of the literal that lies
+		     wholly in the current string, or else to where an
+		     occurrence could straddle the two strings, and let
+		     the loops below check those few places.  */
+		  ptrdiff_t avail = min (range - lim + literal_len - 1,
+					 (startpos < size1 ? size1 : total_size)
+					 - startpos);
+		  re_char *found = memmem (d, avail, literal, literal_len);
+		  ptrdiff_t skip = (found ? found - d
+				    : max (0, avail - (literal_len - 1)));
+		  /* Don't stop in the middle of a character.  */
+		  if (multibyte)
+		    while (0 < skip && skip < avail && !CHAR_HEAD_P (d[skip]))
+		      skip--;
+		  skip = min (skip, range - lim);
+		  d += skip;
+		  range -= skip;
+		}
+
 	      /* Written out as an if-else to avoid testing 'translate'
 		 inside the loop.  */
 	      if (!NILP (translate))
@@ -3625,7 +3708,23 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	}
     }
   return -1;
-} /* re_search_2 */
+} /* re_search_2_internal */
+
+/* Like re_search_2_internal, but let the profiler know that a regexp
+   search is running.  */
+
+ptrdiff_t
+re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
+	     const char *str2, ptrdiff_t size2,
+	     ptrdiff_t startpos, ptrdiff_t range,
+	     struct re_registers *regs, ptrdiff_t stop)
+{
+  Lisp_Object outer_frame = enter_c_frame (QRegexp_matching);
+  ptrdiff_t val = re_search_2_internal (bufp, str1, size1, str2, size2,
+					startpos, range, regs, stop);
+  exit_c_frame (outer_frame);
+  return val;
+}
 
 /* Declarations and macros for re_match_2.  */
 
@@ -3912,6 +4011,28 @@ mutually_exclusive_charset (struct re_pattern_buffer *bufp, re_char *p1,
   return false;
 }
 
+/* True if P1, an `exactn` or `charset`, can match only a newline.  */
+static bool
+newline_only_p (struct re_pattern_buffer *bufp, re_char *p1)
+{
+  switch (*p1)
+    {
+    case exactn:
+      return RE_STRING_CHAR (p1 + 2, RE_MULTIBYTE_P (bufp)) == '\n';
+    case charset:
+      if (CHARSET_RANGE_TABLE_EXISTS_P (p1)
+	  || CHARSET_BITMAP_SIZE (p1) <= '\n' / BYTEWIDTH)
+	return false;
+      for (int idx = 0; idx < CHARSET_BITMAP_SIZE (p1); idx++)
+	if (p1[2 + idx] != (idx == '\n' / BYTEWIDTH
+			    ? 1 << ('\n' % BYTEWIDTH) : 0))
+	  return false;
+      return true;
+    default:
+      return false;
+    }
+}
+
 struct mutexcl_data {
   struct re_pattern_buffer *bufp;
   re_char *p1;
@@ -3976,7 +4097,8 @@ mutually_exclusive_one (re_char *p2, void *arg)
 	}
       return false;
     case anychar:
-      return false;             /* FIXME: exactn \n ? */
+      /* '.' fails only on a newline.  */
+      return newline_only_p (data->bufp, data->p1);
     case syntaxspec:
       return (*data->p1 == notsyntaxspec && data->p1[1] == p2[1]);
     case notsyntaxspec:
@@ -4052,9 +4174,11 @@ re_match_2 (struct re_pattern_buffer *bufp,
 
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, pos);
 
+  Lisp_Object outer_frame = enter_c_frame (QRegexp_matching);
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
 				(re_char *) string2, size2,
 				pos, regs, stop);
+  exit_c_frame (outer_frame);
   return result;
 }
 
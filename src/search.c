@@ -37,13 +37,22 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include "regex-emacs.h"
 
-#define REGEXP_CACHE_SIZE 20
+#define REGEXP_CACHE_SIZE 256
+
+/* Number of chains in the hash index of the cache.  */
+#define REGEXP_CACHE_INDEX_SIZE 256
 
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* Neighbors in the list of all entries, most recently used first.  */
+  struct regexp_cache *next, *prev;
+  /* Next entry in the same chain of the hash index.  Only entries
+     whose regexp is non-nil are in the index.  */
+  struct regexp_cache *hash_next;
+  /* Hash code of the text of the regexp.  */
+  EMACS_UINT hash;
   Lisp_Object regexp, f_whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
@@ -60,20 +69,47 @@ struct regexp_cache
 /* The instances of that struct.  */
 static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* The head of the doubly linked list; points to the most recently used
+   buffer.  The tail points to the least recently used one.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
+
+/* Hash index of the entries, by the text of their regexp.  */
+static struct regexp_cache *searchbuf_index[REGEXP_CACHE_INDEX_SIZE];
+
+/* Number of times a regexp was found in the cache, and number of times
+   it had to be compiled.  */
+static EMACS_INT regexp_cache_hits, regexp_cache_misses;
+
+/* Incremented whenever a syntax table changes, so that compiled
+   regexp objects that depend on the syntax table can tell that they
+   must be compiled again.  */
+static EMACS_UINT regexp_syntax_tick;
 
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static void save_search_regs (void);
 static EMACS_INT simple_search (EMACS_INT, unsigned char *, ptrdiff_t,
-				ptrdiff_t, Lisp_Object, ptrdiff_t, ptrdiff_t,
-                                ptrdiff_t, ptrdiff_t);
+				ptrdiff_t, Lisp_Object, Lisp_Object,
+				ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t);
 static EMACS_INT boyer_moore (EMACS_INT, unsigned char *, ptrdiff_t,
                               Lisp_Object, Lisp_Object, ptrdiff_t,
                               ptrdiff_t, int);
+static EMACS_INT literal_search (EMACS_INT, const unsigned char *,
+				 const unsigned char *, ptrdiff_t,
+				 ptrdiff_t, ptrdiff_t);
+static bool literal_pattern_p (unsigned char *, ptrdiff_t, bool,
+			       Lisp_Object, unsigned char *, bool *);
 
 Lisp_Object re_match_object;
 
+/* Signal an error unless REGEXP is a string or a compiled regexp.  */
+
+static void
+check_regexp (Lisp_Object regexp)
+{
+  if (!COMPILED_REGEXP_P (regexp))
+    CHECK_STRING (regexp);
+}
+
 static AVOID
 matcher_overflow (void)
 {
@@ -151,6 +187,35 @@ shrink_regexp_cache (void)
       }
 }
 
+/* Mark the Lisp objects that the cache refers to.
+   This is called from garbage collection.  */
+
+void
+mark_regexp_cache (void)
+{
+  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
+    {
+      mark_object (searchbufs[i].regexp);
+      mark_object (searchbufs[i].f_whitespace_regexp);
+      mark_object (searchbufs[i].syntax_table);
+      mark_object (searchbufs[i].buf.translate);
+    }
+}
+
+/* Remove CP from the hash index, if it is there.  */
+
+static void
+unindex_searchbuf (struct regexp_cache *cp)
+{
+  if (NILP (cp->regexp))
+    return;
+  struct regexp_cache **cpp
+    = &searchbuf_index[cp->hash % REGEXP_CACHE_INDEX_SIZE];
+  while (*cpp != cp)
+    cpp = &(*cpp)->hash_next;
+  *cpp = cp->hash_next;
+}
+
 /* Clear the regexp cache w.r.t. a particular syntax table,
    because it was changed.
    There is no danger of memory leak here because re_compile_pattern
@@ -161,12 +226,16 @@ clear_regexp_cache (void)
 {
   int i;
 
+  regexp_syntax_tick++;
   for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
     /* It's tempting to compare with the syntax-table we've actually changed,
        but it's not sufficient because char-table inheritance means that
        modifying one syntax-table can change others at the same time.  */
     if (!searchbufs[i].busy && !BASE_EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+      {
+	unindex_searchbuf (&searchbufs[i]);
+	searchbufs[i].regexp = Qnil;
+      }
 }
 
 static void
@@ -184,6 +253,142 @@ freeze_pattern (struct regexp_cache *searchbuf)
   searchbuf->busy = true;
 }
 
+/* Return true if CP was compiled for TRANSLATE and POSIX, and for the
+   current syntax table and whitespace regexp.  */
+
+static bool
+searchbuf_matches_p (struct regexp_cache *cp, Lisp_Object translate,
+		     bool posix)
+{
+  return (BASE_EQ (cp->buf.translate, translate)
+	  && cp->posix == posix
+	  && (BASE_EQ (cp->syntax_table, Qt)
+	      || BASE_EQ (cp->syntax_table,
+			  BVAR (current_buffer, syntax_table)))
+	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
+	  && cp->buf.charset_unibyte == charset_unibyte);
+}
+
+/* Return the pattern buffer of the compiled regexp RE, after compiling
+   it again if it was compiled for another TRANSLATE, POSIX, syntax
+   table or whitespace regexp.  Return NULL if a match that uses it is
+   already in progress.  */
+
+static struct regexp_cache *
+compiled_regexp_searchbuf (struct Lisp_Compiled_Regexp *re,
+			   Lisp_Object translate, bool posix)
+{
+  struct regexp_cache *cp = re->cache;
+
+  if (!cp)
+    {
+      cp = xzalloc (sizeof *cp);
+      cp->buf.allocated = 100;
+      cp->buf.buffer = xmalloc (100);
+      cp->buf.fastmap = cp->fastmap;
+      cp->regexp = Qnil;
+      cp->f_whitespace_regexp = Qnil;
+      cp->syntax_table = Qnil;
+      cp->buf.translate = Qnil;
+      re->cache = cp;
+    }
+  else if (cp->busy)
+    return NULL;
+
+  if (!NILP (cp->regexp)
+      && searchbuf_matches_p (cp, translate, posix)
+      && (BASE_EQ (cp->syntax_table, Qt)
+	  || re->syntax_tick == regexp_syntax_tick))
+    {
+      regexp_cache_hits++;
+      return cp;
+    }
+
+  regexp_cache_misses++;
+  compile_pattern_1 (cp, re->pattern, translate, posix);
+  /* RE->pattern cannot change, so there is no need for the copy that
+     compile_pattern_1 made.  */
+  cp->regexp = re->pattern;
+  re->whitespace_regexp = cp->f_whitespace_regexp;
+  re->syntax_table = cp->syntax_table;
+  re->translate = translate;
+  re->syntax_tick = regexp_syntax_tick;
+  return cp;
+}
+
+/* Free the pattern buffer of the compiled regexp RE.
+   This is called from garbage collection.  */
+
+void
+free_compiled_regexp (struct Lisp_Compiled_Regexp *re)
+{
+  if (re->cache)
+    {
+      xfree (re->cache->buf.buffer);
+      xfree (re->cache);
+    }
+}
+
+/* Return an entry of the cache that holds PATTERN compiled for
+   TRANSLATE and POSIX, compiling it into the least recently used entry
+   if it is not there, and mark the entry as most recently used.  */
+
+static struct regexp_cache *
+cached_searchbuf (Lisp_Object pattern, Lisp_Object translate, bool posix)
+{
+  struct regexp_cache *cp;
+  EMACS_UINT hash = hash_char_array (SSDATA (pattern), SBYTES (pattern));
+
+  for (cp = searchbuf_index[hash % REGEXP_CACHE_INDEX_SIZE];
+       cp; cp = cp->hash_next)
+    if (cp->hash == hash
+	&& SCHARS (cp->regexp) == SCHARS (pattern)
+	&& !cp->busy
+	&& STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
+	&& !NILP (Fstring_equal (cp->regexp, pattern))
+	&& searchbuf_matches_p (cp, translate, posix))
+      break;
+
+  if (cp)
+    regexp_cache_hits++;
+  else
+    {
+      /* Compile into the least recently used non-busy cell in the
+	 cache.  */
+      for (cp = searchbuf_tail; cp && cp->busy; cp = cp->prev)
+	continue;
+      if (!cp)
+	error ("Too much matching reentrancy");
+      regexp_cache_misses++;
+      unindex_searchbuf (cp);
+      compile_pattern_1 (cp, pattern, translate, posix);
+      cp->hash = hash;
+      struct regexp_cache **chain
+	= &searchbuf_index[hash % REGEXP_CACHE_INDEX_SIZE];
+      cp->hash_next = *chain;
+      *chain = cp;
+    }
+
+  /* When we get here, cp contains the compiled pattern, either
+     because we found it in the cache or because we just compiled it.
+     Move it to the front of the list to mark it as most recently
+     used.  */
+  if (cp != searchbuf_head)
+    {
+      cp->prev->next = cp->next;
+      if (cp->next)
+	cp->next->prev = cp->prev;
+      else
+	searchbuf_tail = cp->prev;
+      cp->prev = NULL;
+      cp->next = searchbuf_head;
+      searchbuf_head->prev = cp;
+      searchbuf_head = cp;
+    }
+
+  return cp;
+}
+
 /* Compile a regexp if necessary, but first check to see if there's one in
    the cache.
    PATTERN is the pattern to compile.
@@ -193,60 +398,26 @@ freeze_pattern (struct regexp_cache *searchbuf)
    If it is 0, we should compile the pattern not to record any
    subexpression bounds.
    POSIX is true if we want full backtracking (POSIX style) for this pattern.
-   False means backtrack only enough to get a valid match.  */
+   False means backtrack only enough to get a valid match.
+
+   PATTERN can also be a compiled regexp object, whose own pattern
+   buffer is used unless it is busy.  */
 
 static struct regexp_cache *
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp, **lru_nonbusy;
-
-  for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
-    {
-      cp = *cpp;
-      if (!cp->busy)
-        lru_nonbusy = cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
-          && !cp->busy
-	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
-	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && BASE_EQ (cp->buf.translate, translate)
-	  && cp->posix == posix
-	  && (BASE_EQ (cp->syntax_table, Qt)
-	      || BASE_EQ (cp->syntax_table,
-			  BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
-	  && cp->buf.charset_unibyte == charset_unibyte)
-	break;
+  struct regexp_cache *cp = NULL;
 
-      /* If we're at the end of the cache, compile into the last
-	 (least recently used) non-busy cell in the cache.  */
-      if (cp->next == 0)
-	{
-          if (!lru_nonbusy)
-            error ("Too much matching reentrancy");
-          cpp = lru_nonbusy;
-          cp = *cpp;
-	compile_it:
-          eassert (!cp->busy);
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
-	}
+  if (COMPILED_REGEXP_P (pattern))
+    {
+      cp = compiled_regexp_searchbuf (XCOMPILED_REGEXP (pattern),
+				      translate, posix);
+      if (!cp)
+	pattern = XCOMPILED_REGEXP (pattern)->pattern;
     }
-
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  if (!cp)
+    cp = cached_searchbuf (pattern, translate, posix);
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -276,7 +447,7 @@ looking_at_1 (Lisp_Object string, bool posix, bool modify_data)
   set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
 			 BVAR (current_buffer, case_eqv_table));
 
-  CHECK_STRING (string);
+  check_regexp (string);
 
   /* Snapshot in case Lisp changes the value.  */
   bool modify_match_data = NILP (Vinhibit_changing_match_data) && modify_data;
@@ -378,7 +549,7 @@ string_match_1 (Lisp_Object regexp, Lisp_Object string, Lisp_Object start,
   if (running_asynch_code)
     save_search_regs ();
 
-  CHECK_STRING (regexp);
+  check_regexp (regexp);
   CHECK_STRING (string);
 
   if (NILP (start))
@@ -512,7 +683,11 @@ fast_c_string_match_internal (Lisp_Object regexp,
   /* FIXME: This is expensive and not obviously correct when it makes
      a difference. I.e., no longer "fast", and may hide bugs.
      Something should be done about this.  */
-  regexp = string_make_unibyte (regexp);
+  if (COMPILED_REGEXP_P (regexp)
+      && STRING_MULTIBYTE (XCOMPILED_REGEXP (regexp)->pattern))
+    regexp = XCOMPILED_REGEXP (regexp)->pattern;
+  if (STRINGP (regexp))
+    regexp = string_make_unibyte (regexp);
   /* Record specpdl index because freeze_pattern pushes an
      unwind-protect on the specpdl.  */
   specpdl_ref count = SPECPDL_INDEX ();
@@ -1027,6 +1202,320 @@ find_before_next_newline (ptrdiff_t from, ptrdiff_t to,
   return pos;
 }
 
+/* The line index: remembering the number of newlines before
+   positions spread through the buffer.  Line numbers of far away
+   positions can then be computed by counting the newlines between
+   the nearest checkpoint and the position, instead of those between
+   the beginning of the buffer and the position.  Since checkpoints
+   also record both the character and byte positions, they serve
+   conversions between the two as well.
+
+   The index is extended lazily as positions beyond its last
+   checkpoint are looked up.  Insertions shift the checkpoints after
+   them, and any other change drops the checkpoints after its start,
+   so that the common case of appending text to a large buffer keeps
+   the index intact.  */
+
+/* The distance in bytes between consecutive checkpoints.  */
+enum { LINE_INDEX_SPACING = 16 * 1024 };
+
+struct line_checkpoint
+{
+  /* Character and byte position of the checkpoint.  */
+  ptrdiff_t charpos, bytepos;
+
+  /* Number of newlines between BEG and the checkpoint.  */
+  ptrdiff_t lines;
+};
+
+struct line_index
+{
+  /* The checkpoints, in increasing order of position.  The first one
+     is always at BEG.  */
+  struct line_checkpoint *checkpoints;
+
+  /* Number of checkpoints used, and allocated.  */
+  ptrdiff_t used, size;
+};
+
+/* Return the line index of buffer B, creating it if needed.  */
+static struct line_index *
+buffer_line_index (struct buffer *b)
+{
+  if (b->base_buffer)
+    b = b->base_buffer;
+
+  struct line_index *index = b->line_index;
+  if (!index)
+    {
+      index = b->line_index = xzalloc (sizeof *index);
+      __lsan_ignore_object (index);
+      index->checkpoints = xpalloc (NULL, &index->size, 1, -1,
+				    sizeof *index->checkpoints);
+      index->checkpoints[0]
+	= (struct line_checkpoint) { BEG, BEG_BYTE, 0 };
+      index->used = 1;
+    }
+  return index;
+}
+
+void
+free_line_index (struct line_index *index)
+{
+  xfree (index->checkpoints);
+  xfree (index);
+}
+
+/* Count the newlines between FROM_BYTE and TO_BYTE in buffer B,
+   stopping after the COUNTth one.  Ignore the accessible portion of
+   the buffer.  Set *END_BYTE to the byte position where we stopped,
+   and if NCHARS is not NULL, set *NCHARS to the number of characters
+   between FROM_BYTE and *END_BYTE.  */
+static ptrdiff_t
+scan_lines (struct buffer *b, ptrdiff_t from_byte, ptrdiff_t to_byte,
+	    ptrdiff_t count, ptrdiff_t *end_byte, ptrdiff_t *nchars)
+{
+  ptrdiff_t lines = 0, chars = 0;
+  bool multibyte = BUF_Z (b) != BUF_Z_BYTE (b);
+
+  while (from_byte < to_byte && lines < count)
+    {
+      ptrdiff_t ceiling = (from_byte < BUF_GPT_BYTE (b)
+			   ? min (to_byte, BUF_GPT_BYTE (b)) : to_byte);
+      unsigned char *base = BUF_BYTE_ADDRESS (b, from_byte);
+      unsigned char *limit = BUF_BYTE_ADDRESS (b, ceiling - 1) + 1;
+      unsigned char *cursor = base;
+
+      while (lines < count)
+	{
+	  cursor = memchr (cursor, '\n', limit - cursor);
+	  if (!cursor)
+	    {
+	      cursor = limit;
+	      break;
+	    }
+	  cursor++;
+	  lines++;
+	}
+
+      if (!nchars)
+	;
+      else if (multibyte)
+	for (unsigned char *p = base; p < cursor; p++)
+	  chars += CHAR_HEAD_P (*p);
+      else
+	chars += cursor - base;
+      from_byte += cursor - base;
+    }
+
+  *end_byte = from_byte;
+  if (nchars)
+    *nchars = chars;
+  return lines;
+}
+
+/* Add a checkpoint about LINE_INDEX_SPACING bytes after the last one
+   of INDEX, the index of buffer B.  The last checkpoint must be at
+   least that far from the end of B.  */
+static void
+add_line_checkpoint (struct buffer *b, struct line_index *index)
+{
+  struct line_checkpoint cp = index->checkpoints[index->used - 1];
+  ptrdiff_t next = cp.bytepos + LINE_INDEX_SPACING, nchars;
+
+  while (next < BUF_Z_BYTE (b) && !CHAR_HEAD_P (BUF_FETCH_BYTE (b, next)))
+    next++;
+  cp.lines += scan_lines (b, cp.bytepos, next, PTRDIFF_MAX,
+			  &cp.bytepos, &nchars);
+  cp.charpos += nchars;
+
+  if (index->used == index->size)
+    index->checkpoints = xpalloc (index->checkpoints, &index->size, 1, -1,
+				  sizeof *index->checkpoints);
+  index->checkpoints[index->used++] = cp;
+}
+
+/* Extend INDEX, the index of buffer B, so that its last checkpoint is
+   at or after POS, a byte position if BYTEP and a character position
+   otherwise, or within LINE_INDEX_SPACING bytes of the end of B.  */
+static void
+extend_line_index (struct buffer *b, struct line_index *index,
+		   ptrdiff_t pos, bool bytep)
+{
+  while (true)
+    {
+      struct line_checkpoint *last = &index->checkpoints[index->used - 1];
+      if ((bytep ? last->bytepos : last->charpos) >= pos
+	  || BUF_Z_BYTE (b) - last->bytepos < LINE_INDEX_SPACING)
+	break;
+      add_line_checkpoint (b, index);
+    }
+}
+
+/* Return the index of the last checkpoint of INDEX at or before POS,
+   a byte position if BYTEP and a character position otherwise.  */
+static ptrdiff_t
+line_checkpoint_before (struct line_index *index, ptrdiff_t pos, bool bytep)
+{
+  ptrdiff_t lo = 0, hi = index->used;
+  while (hi - lo > 1)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      struct line_checkpoint *cp = &index->checkpoints[mid];
+      if ((bytep ? cp->bytepos : cp->charpos) <= pos)
+	lo = mid;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+/* Return the number of newlines between BEG_BYTE and BYTEPOS.  */
+static ptrdiff_t
+lines_before (ptrdiff_t bytepos)
+{
+  struct line_index *index = buffer_line_index (current_buffer);
+  extend_line_index (current_buffer, index, bytepos, true);
+  struct line_checkpoint *cp
+    = &index->checkpoints[line_checkpoint_before (index, bytepos, true)];
+  ptrdiff_t ignored;
+  return cp->lines + scan_lines (current_buffer, cp->bytepos, bytepos,
+				 PTRDIFF_MAX, &ignored, NULL);
+}
+
+/* Return the number of newlines between START_BYTE and END_BYTE in
+   the current buffer, which can be outside its accessible portion.
+   Unlike display_count_lines, this ignores selective display.  */
+ptrdiff_t
+line_index_count (ptrdiff_t start_byte, ptrdiff_t end_byte)
+{
+  if (end_byte - start_byte < LINE_INDEX_SPACING)
+    {
+      ptrdiff_t ignored;
+      return scan_lines (current_buffer, start_byte, end_byte, PTRDIFF_MAX,
+			 &ignored, NULL);
+    }
+  return lines_before (end_byte) - lines_before (start_byte);
+}
+
+/* Return the character position after the LINESth newline of the
+   current buffer, counting from BEG, or Z if there are not that many
+   newlines.  Set *BYTEPOS to the corresponding byte position.  */
+ptrdiff_t
+line_index_position (ptrdiff_t lines, ptrdiff_t *bytepos)
+{
+  if (lines <= 0)
+    {
+      *bytepos = BEG_BYTE;
+      return BEG;
+    }
+
+  struct line_index *index = buffer_line_index (current_buffer);
+
+  while (index->checkpoints[index->used - 1].lines < lines
+	 && (Z_BYTE - index->checkpoints[index->used - 1].bytepos
+	     >= LINE_INDEX_SPACING))
+    add_line_checkpoint (current_buffer, index);
+
+  /* Find the last checkpoint before the LINESth newline.  */
+  ptrdiff_t lo = 0, hi = index->used;
+  while (hi - lo > 1)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (index->checkpoints[mid].lines < lines)
+	lo = mid;
+      else
+	hi = mid;
+    }
+
+  struct line_checkpoint *cp = &index->checkpoints[lo];
+  ptrdiff_t nchars;
+  scan_lines (current_buffer, cp->bytepos, Z_BYTE, lines - cp->lines,
+	      bytepos, &nchars);
+  return cp->charpos + nchars;
+}
+
+/* Find the checkpoints of the line index of buffer B around POS, a
+   byte position if BYTEP and a character position otherwise.  Set
+   *BELOW and *BELOW_BYTE to the character and byte position of the
+   last checkpoint at or before POS, and *ABOVE and *ABOVE_BYTE to
+   those of the first one after POS, or to the end of B if there is
+   none.  If POS is after the last checkpoint and no farther from it
+   than EXTEND_LIMIT, first extend the index past POS.  Return true if
+   POS is then covered by the index.  */
+bool
+line_index_neighbors (struct buffer *b, ptrdiff_t pos, bool bytep,
+		      ptrdiff_t extend_limit,
+		      ptrdiff_t *below, ptrdiff_t *below_byte,
+		      ptrdiff_t *above, ptrdiff_t *above_byte)
+{
+  struct line_index *index = buffer_line_index (b);
+  struct line_checkpoint *last = &index->checkpoints[index->used - 1];
+  ptrdiff_t last_pos = bytep ? last->bytepos : last->charpos;
+  bool covered = pos <= last_pos;
+
+  if (!covered && pos - last_pos <= extend_limit)
+    {
+      extend_line_index (b, index, pos, bytep);
+      covered = true;
+    }
+
+  ptrdiff_t i = line_checkpoint_before (index, pos, bytep);
+  *below = index->checkpoints[i].charpos;
+  *below_byte = index->checkpoints[i].bytepos;
+  if (i + 1 < index->used)
+    {
+      *above = index->checkpoints[i + 1].charpos;
+      *above_byte = index->checkpoints[i + 1].bytepos;
+    }
+  else
+    {
+      *above = BUF_Z (b);
+      *above_byte = BUF_Z_BYTE (b);
+    }
+  return covered;
+}
+
+/* Update the line index of the current buffer for an insertion from
+   FROM / FROM_BYTE to TO / TO_BYTE.  */
+void
+adjust_line_index_for_insert (ptrdiff_t from, ptrdiff_t from_byte,
+			      ptrdiff_t to, ptrdiff_t to_byte)
+{
+  struct buffer *buf = (current_buffer->base_buffer
+			? current_buffer->base_buffer : current_buffer);
+  struct line_index *index = buf->line_index;
+
+  if (!index || index->checkpoints[index->used - 1].charpos <= from)
+    return;
+
+  ptrdiff_t ignored;
+  ptrdiff_t lines = scan_lines (current_buffer, from_byte, to_byte,
+				PTRDIFF_MAX, &ignored, NULL);
+  for (ptrdiff_t i = index->used - 1;
+       0 < i && from < index->checkpoints[i].charpos; i--)
+    {
+      index->checkpoints[i].charpos += to - from;
+      index->checkpoints[i].bytepos += to_byte - from_byte;
+      index->checkpoints[i].lines += lines;
+    }
+}
+
+/* Drop the checkpoints of the line index of BUF that are after the
+   character position START, because the text after START changed.  */
+void
+invalidate_line_index (struct buffer *buf, ptrdiff_t start)
+{
+  if (buf->base_buffer)
+    buf = buf->base_buffer;
+
+  struct line_index *index = buf->line_index;
+  if (index)
+    while (1 < index->used
+	   && start < index->checkpoints[index->used - 1].charpos)
+      index->used--;
+}
+
 /* Subroutines of Lisp buffer search functions. */
 
 static Lisp_Object
@@ -1044,7 +1533,10 @@ search_command (Lisp_Object string, Lisp_Object bound, Lisp_Object noerror,
       n *= XFIXNUM (count);
     }
 
-  CHECK_STRING (string);
+  if (RE)
+    check_regexp (string);
+  else
+    CHECK_STRING (string);
   if (NILP (bound))
     {
       if (n > 0)
@@ -1485,13 +1977,26 @@ search_buffer_non_re (Lisp_Object string, ptrdiff_t pos,
   len_byte = pat - patbuf;
   pat = base_pat = patbuf;
 
+  /* Search forward for text that needs no translation, or whose
+     case-equivalents differ from it only in the 0x20 bit of a byte,
+     as bytes.  */
+  unsigned char *fold = SAFE_ALLOCA (len_byte);
+  bool folded = false;
+  bool literal = (n > 0
+		  && (NILP (trt)
+		      || literal_pattern_p (pat, len_byte, multibyte,
+					    inverse_trt, fold, &folded)));
+
   EMACS_INT result
-    = (boyer_moore_ok
+    = (literal
+       ? literal_search (n, pat, folded ? fold : NULL, len_byte,
+			 pos_byte, lim_byte)
+       : boyer_moore_ok
        ? boyer_moore (n, pat, len_byte, trt, inverse_trt,
                       pos_byte, lim_byte,
                       char_base)
        : simple_search (n, pat, raw_pattern_size, len_byte, trt,
-                        pos, pos_byte, lim, lim_byte));
+                        inverse_trt, pos, pos_byte, lim, lim_byte));
   SAFE_FREE ();
   return result;
 }
@@ -1499,9 +2004,9 @@ search_buffer_non_re (Lisp_Object string, ptrdiff_t pos,
 /* Search for the Nth occurrence of STRING in the current buffer,
    from buffer position POS/POS_BYTE until LIM/LIM_BYTE.
 
-   If RE, look for matches against the regular expression STRING instead;
-   if POSIX, enable POSIX style backtracking within that regular
-   expression.
+   If RE, look for matches against the regular expression STRING
+   instead, which can also be a compiled regexp; if POSIX, enable
+   POSIX style backtracking within that regular expression.
 
    If N is positive, search forward; in this case, LIM must be greater
    than POS.
@@ -1522,19 +2027,23 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   if (running_asynch_code)
     save_search_regs ();
 
+  /* The text of a compiled regexp, for the checks below.  */
+  Lisp_Object text = (COMPILED_REGEXP_P (string)
+		      ? XCOMPILED_REGEXP (string)->pattern : string);
+
   /* Searching 0 times means don't move.  */
   /* Null string is found at starting position.  */
-  if (n == 0 || SCHARS (string) == 0)
+  if (n == 0 || SCHARS (text) == 0)
     {
       set_search_regs (pos_byte, 0);
       return pos;
     }
 
-  if (RE && !(trivial_regexp_p (string) && NILP (Vsearch_spaces_regexp)))
+  if (RE && !(trivial_regexp_p (text) && NILP (Vsearch_spaces_regexp)))
     pos = search_buffer_re (string, pos, pos_byte, lim, lim_byte,
                             n, trt, inverse_trt, posix);
   else
-    pos = search_buffer_non_re (string, pos, pos_byte, lim, lim_byte,
+    pos = search_buffer_non_re (text, pos, pos_byte, lim, lim_byte,
                                 n, RE, trt, inverse_trt, posix);
 
   return pos;
@@ -1543,7 +2052,7 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
 /* Do a simple string search N times for the string PAT,
    whose length is LEN/LEN_BYTE,
    from buffer position POS/POS_BYTE until LIM/LIM_BYTE.
-   TRT is the translation table.
+   TRT and INVERSE_TRT are translation tables.
 
    Return the character position where the match is found.
    Otherwise, if M matches remained to be found, return -M.
@@ -1554,7 +2063,8 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
 
 static EMACS_INT
 simple_search (EMACS_INT n, unsigned char *pat,
-	       ptrdiff_t len, ptrdiff_t len_byte, Lisp_Object trt,
+	       ptrdiff_t len, ptrdiff_t len_byte,
+	       Lisp_Object trt, Lisp_Object inverse_trt,
 	       ptrdiff_t pos, ptrdiff_t pos_byte,
 	       ptrdiff_t lim, ptrdiff_t lim_byte)
 {
@@ -1563,49 +2073,90 @@ simple_search (EMACS_INT n, unsigned char *pat,
   /* Number of buffer bytes matched.  Note that this may be different
      from len_byte in a multibyte buffer.  */
   ptrdiff_t match_byte = PTRDIFF_MIN;
+  /* In a multibyte buffer, EDGE_BYTES[B] is true if a character whose
+     first byte (last byte, if searching backward) is B can match the
+     first (last) character of PAT.  Those are the characters that
+     translate into it, which are known only if there is an inverse
+     translation table.  */
+  bool edge_bytes[0400];
+
+  if (multibyte && lim != pos)
+    {
+      bool unknown = !NILP (trt) && NILP (inverse_trt);
+      unsigned char *edge = forward ? pat : pat + len_byte;
+      if (!forward)
+	edge -= raw_prev_char_len (edge);
+      int edge_ch = STRING_CHAR (edge), ch = edge_ch;
+      for (int i = 0; i < 0400; i++)
+	edge_bytes[i] = unknown;
+      do
+	{
+	  unsigned char str[MAX_MULTIBYTE_LENGTH];
+	  int charlen = CHAR_STRING (ch, str);
+	  edge_bytes[str[forward ? 0 : charlen - 1]] = true;
+	  TRANSLATE (ch, inverse_trt, ch);
+	}
+      while (ch != edge_ch);
+    }
 
   if (lim > pos && multibyte)
-    while (n > 0)
-      {
-	while (1)
-	  {
-	    /* Try matching at position POS.  */
-	    ptrdiff_t this_pos_byte = pos_byte;
-	    ptrdiff_t this_len = len;
-	    unsigned char *p = pat;
-	    if (pos + len > lim || pos_byte + len_byte > lim_byte)
-	      goto stop;
+    {
+      while (n > 0)
+	{
+	  while (1)
+	    {
+	      /* Skip the characters that cannot start a match, up to
+		 the gap or LIM_BYTE.  */
+	      ptrdiff_t skip_end = min (BUFFER_CEILING_OF (pos_byte) + 1,
+					lim_byte);
+	      if (pos_byte < skip_end)
+		{
+		  unsigned char *start = BYTE_POS_ADDR (pos_byte);
+		  unsigned char *cursor = start;
+		  unsigned char *cursor_end = start + (skip_end - pos_byte);
+		  for (; cursor < cursor_end && !edge_bytes[*cursor]; cursor++)
+		    pos += CHAR_HEAD_P (*cursor);
+		  pos_byte += cursor - start;
+		}
 
-	    while (this_len > 0)
-	      {
-		int charlen, pat_ch = string_char_and_length (p, &charlen);
-		int buf_charlen, buf_ch
-		  = string_char_and_length (BYTE_POS_ADDR (this_pos_byte),
-					    &buf_charlen);
-		TRANSLATE (buf_ch, trt, buf_ch);
+	      /* Try matching at position POS.  */
+	      ptrdiff_t this_pos_byte = pos_byte;
+	      ptrdiff_t this_len = len;
+	      unsigned char *p = pat;
+	      if (pos + len > lim || pos_byte + len_byte > lim_byte)
+		goto stop;
 
-		if (buf_ch != pat_ch)
-		  break;
+	      while (this_len > 0)
+		{
+		  int charlen, pat_ch = string_char_and_length (p, &charlen);
+		  int buf_charlen, buf_ch
+		    = string_char_and_length (BYTE_POS_ADDR (this_pos_byte),
+					      &buf_charlen);
+		  TRANSLATE (buf_ch, trt, buf_ch);
 
-		this_len--;
-		p += charlen;
+		  if (buf_ch != pat_ch)
+		    break;
 
-		this_pos_byte += buf_charlen;
-	      }
+		  this_len--;
+		  p += charlen;
 
-	    if (this_len == 0)
-	      {
-		match_byte = this_pos_byte - pos_byte;
-		pos += len;
-		pos_byte += match_byte;
-		break;
-	      }
+		  this_pos_byte += buf_charlen;
+		}
 
-	    inc_both (&pos, &pos_byte);
-	  }
+	      if (this_len == 0)
+		{
+		  match_byte = this_pos_byte - pos_byte;
+		  pos += len;
+		  pos_byte += match_byte;
+		  break;
+		}
 
-	n--;
-      }
+	      inc_both (&pos, &pos_byte);
+	    }
+
+	  n--;
+	}
+    }
   else if (lim > pos)
     while (n > 0)
       {
@@ -1650,6 +2201,23 @@ simple_search (EMACS_INT n, unsigned char *pat,
       {
 	while (1)
 	  {
+	    /* Skip the characters that cannot end a match, down to the
+	       gap or LIM_BYTE.  Stop only at character boundaries.  */
+	    ptrdiff_t skip_start = max (BUFFER_FLOOR_OF (pos_byte - 1),
+					lim_byte);
+	    if (skip_start < pos_byte)
+	      {
+		unsigned char *end = BYTE_POS_ADDR (pos_byte - 1) + 1;
+		unsigned char *cursor = end;
+		unsigned char *cursor_start = end - (pos_byte - skip_start);
+		for (; (cursor > cursor_start
+			&& (!edge_bytes[cursor[-1]]
+			    || (cursor < end && !CHAR_HEAD_P (*cursor))));
+		     cursor--)
+		  pos -= CHAR_HEAD_P (cursor[-1]);
+		pos_byte -= end - cursor;
+	      }
+
 	    /* Try matching at position POS.  */
 	    ptrdiff_t this_pos = pos;
 	    ptrdiff_t this_pos_byte = pos_byte;
@@ -2170,6 +2738,180 @@ boyer_moore (EMACS_INT n, unsigned char *base_pat,
   return BYTE_TO_CHAR (pos_byte);
 }
 
+/* Literal search.
+
+   Most searches are for text that is either not translated at all,
+   or whose only case-equivalents are single-byte characters, such as
+   ASCII letters, that differ from it in the 0x20 bit.  Such text can
+   be searched for as a plain sequence of bytes, except that some of
+   these bytes may have their 0x20 bit either set or cleared.
+   Describe this with a FOLD array that has 0x20 for the bytes that
+   may differ in that bit and 0 for the others; the pattern itself has
+   these bits set.  A NULL FOLD means the bytes must match exactly.  */
+
+/* Buffer text is searched this many bytes at a time, so that the
+   search can be quit.  */
+#define LITERAL_SEARCH_CHUNK (1024 * 1024)
+
+/* A word with each of its bytes equal to B.  */
+#define BYTE_WORD(b) (UINTPTR_MAX / UCHAR_MAX * (b))
+
+/* Return true if the LEN_BYTE bytes at P match PAT and FOLD.  */
+
+static bool
+literal_match_p (const unsigned char *p, const unsigned char *pat,
+		 const unsigned char *fold, ptrdiff_t len_byte)
+{
+  for (ptrdiff_t i = 0; i < len_byte; i++)
+    if ((p[i] | fold[i]) != pat[i])
+      return false;
+  return true;
+}
+
+/* Return the first place in the LEN bytes at P where PAT and FOLD
+   match, or NULL if there is none.
+
+   Look for the first and the last byte of PAT at once a word at a
+   time, and compare the rest only where both are found.  */
+
+static unsigned char *
+literal_memmem (unsigned char *p, ptrdiff_t len, const unsigned char *pat,
+		const unsigned char *fold, ptrdiff_t len_byte)
+{
+  ptrdiff_t last = len_byte - 1, stop = len - len_byte, i = 0;
+  uintptr_t first_fold = BYTE_WORD (fold[0]);
+  uintptr_t first_pat = BYTE_WORD (pat[0]);
+  uintptr_t last_fold = BYTE_WORD (fold[last]);
+  uintptr_t last_pat = BYTE_WORD (pat[last]);
+  uintptr_t w1, w2;
+
+  for (; i <= stop - (ptrdiff_t) (sizeof w1 - 1); i += sizeof w1)
+    {
+      memcpy (&w1, p + i, sizeof w1);
+      memcpy (&w2, p + i + last, sizeof w2);
+      /* The bytes of DIFF are zero where a match may start.  */
+      uintptr_t diff = (((w1 | first_fold) ^ first_pat)
+			| ((w2 | last_fold) ^ last_pat));
+      if ((diff - BYTE_WORD (1)) & ~diff & BYTE_WORD (0x80))
+	for (ptrdiff_t j = i; j < i + (ptrdiff_t) sizeof w1; j++)
+	  if (literal_match_p (p + j, pat, fold, len_byte))
+	    return p + j;
+    }
+  for (; i <= stop; i++)
+    if (literal_match_p (p + i, pat, fold, len_byte))
+      return p + i;
+  return NULL;
+}
+
+/* Return the byte position of the first match for PAT and FOLD,
+   whose length is LEN_BYTE, in the current buffer between POS_BYTE
+   and LIM_BYTE, or -1 if there is none.  */
+
+static ptrdiff_t
+literal_find (const unsigned char *pat, const unsigned char *fold,
+	      ptrdiff_t len_byte, ptrdiff_t pos_byte, ptrdiff_t lim_byte)
+{
+  while (lim_byte - pos_byte >= len_byte)
+    {
+      maybe_quit ();
+
+      /* Look for matches that lie in the text up to the gap or LIM_BYTE,
+	 a chunk at a time.  */
+      ptrdiff_t end = min (BUFFER_CEILING_OF (pos_byte) + 1, lim_byte);
+      ptrdiff_t chunk_end = end;
+      if (end - pos_byte > LITERAL_SEARCH_CHUNK + len_byte)
+	chunk_end = pos_byte + LITERAL_SEARCH_CHUNK + len_byte - 1;
+      unsigned char *p = BYTE_POS_ADDR (pos_byte);
+      unsigned char *found
+	= (fold
+	   ? literal_memmem (p, chunk_end - pos_byte, pat, fold, len_byte)
+	   : memmem (p, chunk_end - pos_byte, pat, len_byte));
+      if (found)
+	return pos_byte + (found - p);
+      if (chunk_end < end)
+	{
+	  pos_byte = chunk_end - len_byte + 1;
+	  continue;
+	}
+
+      /* Then for those that straddle the gap.  */
+      for (ptrdiff_t start = max (pos_byte, end - len_byte + 1);
+	   start < end && start + len_byte <= lim_byte; start++)
+	{
+	  ptrdiff_t i;
+	  for (i = 0; i < len_byte; i++)
+	    if ((FETCH_BYTE (start + i) | (fold ? fold[i] : 0)) != pat[i])
+	      break;
+	  if (i == len_byte)
+	    return start;
+	}
+      pos_byte = end;
+    }
+  return -1;
+}
+
+/* Search forward N times for PAT and FOLD, whose length is LEN_BYTE,
+   from buffer position POS_BYTE until LIM_BYTE.  Return like
+   boyer_moore does.  */
+
+static EMACS_INT
+literal_search (EMACS_INT n, const unsigned char *pat,
+		const unsigned char *fold, ptrdiff_t len_byte,
+		ptrdiff_t pos_byte, ptrdiff_t lim_byte)
+{
+  ptrdiff_t found;
+
+  eassert (n > 0);
+  do
+    {
+      found = literal_find (pat, fold, len_byte, pos_byte, lim_byte);
+      if (found < 0)
+	return -n;
+      pos_byte = found + len_byte;
+    }
+  while (--n > 0);
+
+  set_search_regs (found, len_byte);
+  return BYTE_TO_CHAR (pos_byte);
+}
+
+/* Return true if the translated pattern PAT, whose length is
+   LEN_BYTE, can be searched for by literal_search, given the inverse
+   translation table INVERSE_TRT.  MULTIBYTE says whether PAT is
+   multibyte.  If it can, set the 0x20 bit in the bytes of PAT that may
+   differ in that bit, store the FOLD array described above in FOLD,
+   and set *FOLDED if any of its elements are nonzero.  */
+
+static bool
+literal_pattern_p (unsigned char *pat, ptrdiff_t len_byte, bool multibyte,
+		   Lisp_Object inverse_trt, unsigned char *fold, bool *folded)
+{
+  *folded = false;
+  for (ptrdiff_t i = 0; i < len_byte; )
+    {
+      int charlen = 1;
+      int c = multibyte ? string_char_and_length (pat + i, &charlen) : pat[i];
+      int inverse;
+
+      memset (fold + i, 0, charlen);
+      TRANSLATE (inverse, inverse_trt, c);
+      if (inverse != c)
+	{
+	  if (charlen != 1 || (inverse ^ c) != 0x20)
+	    return false;
+	  TRANSLATE (inverse, inverse_trt, inverse);
+	  if (inverse != c)
+	    return false;
+	  fold[i] = 0x20;
+	  *folded = true;
+	}
+      i += charlen;
+    }
+  for (ptrdiff_t i = 0; i < len_byte; i++)
+    pat[i] |= fold[i];
+  return true;
+}
+
 /* Record beginning BEG_BYTE and end BEG_BYTE + NBYTES
    for the overall match just found in the current buffer.
    Also clear out the match data for registers 1 and up.  */
@@ -3289,6 +4031,72 @@ find_newline1 (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
   return start;
 }
 
+DEFUN ("regexp-compile", Fregexp_compile, Sregexp_compile, 1, 1, 0,
+       doc: /* Return REGEXP compiled into an object for searching.
+The value can be passed instead of REGEXP to `string-match',
+`looking-at', `re-search-forward' and the other functions that search
+for a regexp.  These then use the compiled form kept in the object,
+without looking up REGEXP in the cache of compiled regexps.
+
+REGEXP is compiled for the current values of `case-fold-search' and
+`search-spaces-regexp', and for the current syntax table if it uses
+syntax classes.  When the object is used under different values, it
+is compiled again for them.  If REGEXP is already a compiled regexp,
+return it.  */)
+  (Lisp_Object regexp)
+{
+  if (COMPILED_REGEXP_P (regexp))
+    return regexp;
+  CHECK_STRING (regexp);
+
+  struct Lisp_Compiled_Regexp *re
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Compiled_Regexp, translate,
+				    PVEC_COMPILED_REGEXP);
+  Lisp_Object val = make_lisp_ptr (re, Lisp_Vectorlike);
+  re->pattern = Fcopy_sequence (regexp);
+
+  /* This is so set_image_of_range_1 in regex-emacs.c can find the EQV
+     table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+  compiled_regexp_searchbuf (re,
+			     (!NILP (Vcase_fold_search)
+			      ? BVAR (current_buffer, case_canon_table)
+			      : Qnil),
+			     false);
+  return val;
+}
+
+DEFUN ("compiled-regexp-p", Fcompiled_regexp_p, Scompiled_regexp_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is a regexp compiled by `regexp-compile'.  */)
+  (Lisp_Object object)
+{
+  return COMPILED_REGEXP_P (object) ? Qt : Qnil;
+}
+
+DEFUN ("compiled-regexp-pattern", Fcompiled_regexp_pattern,
+       Scompiled_regexp_pattern, 1, 1, 0,
+       doc: /* Return the regexp that REGEXP was compiled from.
+REGEXP must be a value returned by `regexp-compile'.  */)
+  (Lisp_Object regexp)
+{
+  CHECK_TYPE (COMPILED_REGEXP_P (regexp), Qcompiled_regexp_p, regexp);
+  return Fcopy_sequence (XCOMPILED_REGEXP (regexp)->pattern);
+}
+
+DEFUN ("regexp-cache-statistics", Fregexp_cache_statistics,
+       Sregexp_cache_statistics, 0, 0, 0,
+       doc: /* Return statistics about the cache of compiled regexps.
+The value is a list (HITS MISSES SIZE).  HITS is the number of times a
+regexp that was needed had already been compiled and was found in the
+cache, MISSES is the number of times it had to be compiled, and SIZE is
+the number of compiled regexps that the cache can hold.  */)
+  (void)
+{
+  return list3 (make_int (regexp_cache_hits), make_int (regexp_cache_misses),
+		make_fixnum (REGEXP_CACHE_SIZE));
+}
+
 DEFUN ("newline-cache-check", Fnewline_cache_check, Snewline_cache_check,
        0, 1, 0,
        doc: /* Check the newline cache of BUFFER against buffer contents.
@@ -3378,7 +4186,7 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
 If RAW is non-nil, just return the actual bytecode.  */)
   (Lisp_Object regexp, Lisp_Object raw)
 {
-  CHECK_STRING (regexp);
+  check_regexp (regexp);
   struct regexp_cache *cache_entry
     = compile_pattern (regexp, NULL,
                        (!NILP (Vcase_fold_search)
@@ -3419,13 +4227,6 @@ static void syms_of_search_for_pdumper (void);
 void
 syms_of_search (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].f_whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
-    }
-
   /* Error condition used for failing searches.  */
   DEFSYM (Qsearch_failed, "search-failed");
 
@@ -3436,6 +4237,8 @@ syms_of_search (void)
   /* Error condition signaled when regexp compile_pattern fails.  */
   DEFSYM (Qinvalid_regexp, "invalid-regexp");
 
+  DEFSYM (Qcompiled_regexp_p, "compiled-regexp-p");
+
   Fput (Qsearch_failed, Qerror_conditions,
 	list (Qsearch_failed, Qerror));
   Fput (Qsearch_failed, Qerror_message,
@@ -3491,6 +4294,10 @@ is to bind it with `let' around a small expression.  */);
   defsubr (&Smatch_data__translate);
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
+  defsubr (&Sregexp_compile);
+  defsubr (&Scompiled_regexp_p);
+  defsubr (&Scompiled_regexp_pattern);
+  defsubr (&Sregexp_cache_statistics);
   defsubr (&Sre__describe_compiled);
 
   pdumper_do_now_and_after_load (syms_of_search_for_pdumper);
@@ -3508,7 +4315,12 @@ syms_of_search_for_pdumper (void)
       searchbufs[i].f_whitespace_regexp = Qnil;
       searchbufs[i].busy = false;
       searchbufs[i].syntax_table = Qnil;
+      searchbufs[i].buf.translate = Qnil;
       searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
+      searchbufs[i].prev = (i == 0 ? 0 : &searchbufs[i-1]);
+      searchbufs[i].hash_next = 0;
     }
   searchbuf_head = &searchbufs[0];
+  searchbuf_tail = &searchbufs[REGEXP_CACHE_SIZE - 1];
+  memset (searchbuf_index, 0, sizeof searchbuf_index);
 }
@@ -3066,7 +3066,11 @@ that point is zero, and signal an error if the depth is nonzero.  */)
   CHECK_FIXNUM (count);
   CHECK_FIXNUM (depth);
 
-  return scan_lists (XFIXNUM (from), XFIXNUM (count), XFIXNUM (depth), 0);
+  Lisp_Object outer_frame = enter_c_frame (QScanning_lists);
+  Lisp_Object val = scan_lists (XFIXNUM (from), XFIXNUM (count),
+				XFIXNUM (depth), 0);
+  exit_c_frame (outer_frame);
+  return val;
 }
 
 DEFUN ("scan-sexps", Fscan_sexps, Sscan_sexps, 2, 2, 0,
@@ -3085,7 +3089,10 @@ but before count is used up, nil is returned.  */)
   CHECK_FIXNUM (from);
   CHECK_FIXNUM (count);
 
-  return scan_lists (XFIXNUM (from), XFIXNUM (count), 0, 1);
+  Lisp_Object outer_frame = enter_c_frame (QScanning_lists);
+  Lisp_Object val = scan_lists (XFIXNUM (from), XFIXNUM (count), 0, 1);
+  exit_c_frame (outer_frame);
+  return val;
 }
 
 DEFUN ("backward-prefix-chars", Fbackward_prefix_chars, Sbackward_prefix_chars,
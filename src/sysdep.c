@@ -2771,8 +2771,13 @@ emacs_intr_read (int fd, void *buf, ptrdiff_t nbyte, bool interruptible)
   do
     {
       if (interruptible)
-	maybe_quit ();
+	{
+	  maybe_quit ();
+	  current_thread->blocked = BLOCKED_IN_IO;
+	}
       result = read (fd, buf, nbyte);
+      if (interruptible)
+	current_thread->blocked = NOT_BLOCKED;
     }
   while (result < 0 && errno == EINTR);
 
@@ -2810,7 +2815,11 @@ emacs_full_write (int fd, char const *buf, ptrdiff_t nbyte,
 
   while (nbyte > 0)
     {
+      if (0 < interruptible)
+	current_thread->blocked = BLOCKED_IN_IO;
       ssize_t n = write (fd, buf, min (nbyte, SYS_BUFSIZE_MAX));
+      if (0 < interruptible)
+	current_thread->blocked = NOT_BLOCKED;
 
       if (n < 0)
 	{
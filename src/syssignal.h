@@ -54,6 +54,10 @@ extern void unblock_tty_out_signal (sigset_t const *);
 # define PROFILER_CPU_SUPPORT
 #endif
 
+#if defined PROFILER_CPU_SUPPORT && defined HAVE_PERF_EVENT
+# define PROFILER_PERF_SUPPORT
+#endif
+
 extern sigset_t empty_mask;
 
 typedef void (*signal_handler_t) (int);
@@ -157,7 +157,9 @@ post_acquire_global_lock (struct thread_state *self)
 static void
 acquire_global_lock (struct thread_state *self)
 {
+  self->blocked = BLOCKED_ON_LOCK;
   sys_mutex_lock (&global_lock);
+  self->blocked = NOT_BLOCKED;
   post_acquire_global_lock (self);
 }
 
@@ -621,8 +623,10 @@ really_call_select (void *arg)
   release_global_lock ();
   restore_signal_mask (&oldset);
 
+  self->blocked = BLOCKED_IN_SELECT;
   sa->result = (sa->func) (sa->max_fds, sa->rfds, sa->wfds, sa->efds,
 			   sa->timeout, sa->sigmask);
+  self->blocked = NOT_BLOCKED;
 
   release_select_lock ();
 
@@ -59,6 +59,15 @@ struct bc_thread_state {
   char *stack_end;
 };
 
+/* What a thread is blocked in, for the benefit of the profiler.  */
+enum thread_blocked
+  {
+    NOT_BLOCKED,
+    BLOCKED_IN_SELECT,		/* Waiting for input or a timeout.  */
+    BLOCKED_IN_IO,		/* Reading or writing a file.  */
+    BLOCKED_ON_LOCK		/* Waiting for the global lock.  */
+  };
+
 struct thread_state
 {
   union vectorlike_header header;
@@ -213,6 +222,15 @@ struct thread_state
      It must do so ASAP.  */
   int not_holding_lock;
 
+  /* What this thread is blocked in, if anything.  This is only
+     approximate, as it is only used to label profiler samples.  */
+  enum thread_blocked blocked;
+
+  /* The expensive C code this thread is running, such as a regexp
+     search, as a builtin symbol naming it for the profiler; or nil.
+     It is not traced by GC, so it must not hold any other object.  */
+  Lisp_Object c_frame;
+
   /* Threads are kept on a linked list.  */
   struct thread_state *next_thread;
 
@@ -320,6 +338,24 @@ XCONDVAR (Lisp_Object a)
 }
 
 extern struct thread_state *current_thread;
+
+/* Tell the profiler that the current thread is running the C code
+   named by the builtin symbol FRAME.  Return what it was running
+   before, to be passed to exit_c_frame when that code is done.  */
+INLINE Lisp_Object
+enter_c_frame (Lisp_Object frame)
+{
+  Lisp_Object outer = current_thread->c_frame;
+  current_thread->c_frame = frame;
+  return outer;
+}
+
+INLINE void
+exit_c_frame (Lisp_Object outer)
+{
+  current_thread->c_frame = outer;
+}
+
 extern struct thread_state *all_threads;
 
 extern void finalize_one_thread (struct thread_state *state);
@@ -1781,7 +1781,7 @@ window_point (struct window *w)
 {
   return (w == XWINDOW (selected_window)
           ? BUF_PT (XBUFFER (w->contents))
-          : XMARKER (w->pointm)->charpos);
+          : marker_charpos (XMARKER (w->pointm)));
 }
 
 DEFUN ("window-point", Fwindow_point, Swindow_point, 0, 1, 0,
@@ -5660,11 +5660,13 @@ set correctly.  See the code of `split-window' for how this is done.  */)
       /* Get dead window back its old buffer and markers.  */
       wset_buffer (n, n->old_buffer);
       set_marker_restricted
-	(n->start, make_fixnum (XMARKER (n->start)->charpos), n->contents);
+	(n->start, make_fixnum (marker_charpos (XMARKER (n->start))),
+	 n->contents);
       set_marker_restricted
-	(n->pointm, make_fixnum (XMARKER (n->pointm)->charpos), n->contents);
+	(n->pointm, make_fixnum (marker_charpos (XMARKER (n->pointm))),
+	 n->contents);
       set_marker_restricted
-	(n->old_pointm, make_fixnum (XMARKER (n->old_pointm)->charpos),
+	(n->old_pointm, make_fixnum (marker_charpos (XMARKER (n->old_pointm))),
 	 n->contents);
 
       Vwindow_list = Qnil;
@@ -6853,6 +6855,7 @@ window_scroll_line_based (Lisp_Object window, int n, bool whole, bool noerror)
 
   if (lose)
     {
+      detach_marker (opoint_marker);
       if (noerror)
 	return;
       else
@@ -6950,12 +6953,15 @@ window_scroll_line_based (Lisp_Object window, int n, bool whole, bool noerror)
     }
   else
     {
+      detach_marker (opoint_marker);
       if (noerror)
 	return;
       else
 	xsignal0 (Qend_of_buffer);
     }
 
+  detach_marker (opoint_marker);
+
   if (adjust_old_pointm)
     Fset_marker (w->old_pointm,
 		 ((w == XWINDOW (selected_window))
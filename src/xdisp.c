@@ -12242,6 +12242,7 @@ DEFUN ("display--line-is-continued-p", Fdisplay__line_is_continued_p,
 	  rc = move_it_in_display_line_to (&it, ZV, -1, MOVE_TO_POS);
 	}
       SET_PT_BOTH (marker_position (opoint), marker_byte_position (opoint));
+      detach_marker (opoint);
       bidi_unshelve_cache (itdata, false);
     }
   set_buffer_internal_1 (oldb);
@@ -17423,6 +17424,11 @@ redisplay_internal (void)
   redisplaying_p = true;
   block_buffer_flips ();
   specbind (Qinhibit_free_realized_faces, Qnil);
+  if (profiler_record_events)
+    {
+      record_trace_event (TRACE_REDISPLAY, true, NULL);
+      record_unwind_protect_int (record_trace_event_end, TRACE_REDISPLAY);
+    }
 
   /* Record this function, so it appears on the profiler's backtraces.  */
   record_in_backtrace (Qredisplay_internal_xC_functionx, 0, 0);
@@ -29888,7 +29894,8 @@ ptrdiff_t
 count_lines (ptrdiff_t start_byte, ptrdiff_t end_byte)
 {
   ptrdiff_t ignored;
-  return display_count_lines (start_byte, end_byte, ZV, &ignored);
+  return display_count_lines (start_byte, end_byte,
+			      max (ZV, end_byte - start_byte), &ignored);
 }
 
 /* Count up to COUNT lines starting from START_BYTE.  COUNT negative
@@ -29919,6 +29926,14 @@ display_count_lines (ptrdiff_t start_byte,
     = (!NILP (BVAR (current_buffer, selective_display))
        && !FIXNUMP (BVAR (current_buffer, selective_display)));
 
+  /* If there cannot be COUNT lines before LIMIT_BYTE, all we need is
+     the number of lines up to there, which the line index knows.  */
+  if (count > 0 && limit_byte - start_byte <= count && !selective_display)
+    {
+      *byte_pos_ptr = limit_byte;
+      return max (0, line_index_count (start_byte, limit_byte));
+    }
+
   if (count > 0)
     {
       while (start_byte < limit_byte)
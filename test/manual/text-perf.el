@@ -0,0 +1,170 @@
+;;; text-perf.el --- timing of text primitives  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2026 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Time primitives whose cost grows with the amount of text they
+;; handle.  Each benchmark is a function in `text-perf-benchmarks'
+;; that takes the size of its text in megabytes, or nil for its own
+;; default size, and prints its results.  Run them all with
+;;
+;;   emacs -Q --batch -l text-perf.el -f text-perf-run-batch [MB]
+;;
+;; or a single one with, for instance,
+;;
+;;   emacs -Q --batch -l text-perf.el --eval '(text-perf-character 4)'
+
+;;; Code:
+
+(defun text-perf--time (label function &optional repetitions)
+  "Call FUNCTION REPETITIONS times and print LABEL and the time taken.
+REPETITIONS defaults to 1.  Leave out the time spent collecting
+garbage."
+  (garbage-collect)
+  (let ((result (benchmark-call function (or repetitions 1))))
+    (message "%-40s %8.3f s" label (- (car result) (nth 2 result)))))
+
+;;;; Multibyte text conversions in character.c
+
+(defvar text-perf-character-repetitions 20
+  "Number of times to repeat each conversion.")
+
+(defun text-perf--character-texts (size)
+  "Return an alist of (NAME . UNIBYTE-STRING) of about SIZE bytes each."
+  (let ((cjk (encode-coding-string
+              (apply #'concat
+                     (make-list (/ size 64)
+                                "漢字かな交じり文 mixed with ASCII words\n"))
+              'utf-8-emacs))
+        (raw (apply #'unibyte-string
+                    (mapcar (lambda (i) (+ 128 (% i 128)))
+                            (number-sequence 1 size)))))
+    `((ascii . ,(make-string size ?x))
+      (cjk . ,cjk)
+      (raw . ,raw))))
+
+(defun text-perf-character (&optional megabytes)
+  "Time conversions of ASCII, mostly CJK and raw-byte texts.
+Each text has MEGABYTES megabytes, 1 by default."
+  (dolist (text (text-perf--character-texts
+                 (* (or megabytes 1) 1024 1024)))
+    (let ((u (cdr text)))
+      (dolist (test `(("string-to-multibyte"
+                       . ,(lambda () (string-to-multibyte u)))
+                      ("string-as-multibyte"
+                       . ,(lambda ()
+                            (with-no-warnings (string-as-multibyte u))))
+                      ("format"
+                       . ,(let ((m (with-no-warnings
+                                     (string-as-multibyte u))))
+                            (lambda () (format "%s." m))))
+                      ("insert"
+                       . ,(lambda ()
+                            (with-temp-buffer (insert u))))))
+        (text-perf--time (format "%s %s" (car text) (car test))
+                         (cdr test) text-perf-character-repetitions)))))
+
+;;;; Literal string searches in search.c
+
+(defconst text-perf-search-line
+  "2026-10-16 12:00:00 INFO worker[42]: processed request id=123456 in 7 ms\n"
+  "A line of the buffer to search.")
+
+(defconst text-perf-search-strings
+  '("needle" "request id=999" "ZQUAKS" "Straße" "日本語")
+  "Strings to search for.  They occur only at the end of the buffer.")
+
+(defun text-perf-search (&optional megabytes)
+  "Time `search-forward' and `search-backward' through log-like lines.
+Search a buffer of MEGABYTES megabytes, 256 by default, for strings
+that occur only at its end, with and without case folding."
+  (with-temp-buffer
+    (dotimes (_ (/ (* (or megabytes 256) 1024 1024)
+                   (length text-perf-search-line)))
+      (insert text-perf-search-line))
+    (dolist (string text-perf-search-strings)
+      (insert string "\n"))
+    ;; Put the gap in the middle, where searches have to cross it.
+    (goto-char (/ (point-max) 2))
+    (insert " ")
+    (delete-char -1)
+    (dolist (string text-perf-search-strings)
+      (dolist (case-fold-search '(nil t))
+        (text-perf--time (format "%S case-fold %s forward"
+                                 string case-fold-search)
+                         (lambda ()
+                           (goto-char (point-min))
+                           (search-forward string)))
+        ;; There is no second occurrence, so this searches the whole
+        ;; buffer.
+        (text-perf--time (format "%S case-fold %s backward"
+                                 string case-fold-search)
+                         (lambda ()
+                           (goto-char (point-max))
+                           (search-backward string nil t 2)))))))
+
+;;;; Replacements in insdel.c
+
+(defvar text-perf-replace-count 1000
+  "Number of replacements to make in each test.")
+
+(defun text-perf-replace (&optional megabytes)
+  "Time replacements made in order and at random places.
+Make them in a buffer of MEGABYTES megabytes, 256 by default, with
+texts of the same length as the replaced ones and of another length."
+  (with-temp-buffer
+    (insert (make-string (* (or megabytes 256) 1024 1024) ?a))
+    (let* ((step (/ (buffer-size) text-perf-replace-count))
+           (ordered (number-sequence 1 (- (point-max) step) step))
+           (scattered (progn
+                        (random "text-perf-replace")
+                        (mapcar (lambda (_)
+                                  (1+ (random (- (point-max) step))))
+                                ordered))))
+      (dolist (new '("bcd" "bcde"))
+        (dolist (positions `((ordered . ,ordered)
+                             (scattered . ,scattered)))
+          (text-perf--time (format "%s %d by %d chars"
+                                   (car positions) text-perf-replace-count
+                                   (length new))
+                           (lambda ()
+                             (dolist (pos (cdr positions))
+                               (goto-char pos)
+                               (looking-at "...")
+                               (replace-match new t t)))))))))
+
+;;;; Running the benchmarks
+
+(defvar text-perf-benchmarks
+  '(text-perf-character text-perf-search text-perf-replace)
+  "Benchmark functions that `text-perf-run' calls, in order.")
+
+(defun text-perf-run (&optional megabytes)
+  "Call each of `text-perf-benchmarks' with MEGABYTES."
+  (dolist (benchmark text-perf-benchmarks)
+    (message "%s:" benchmark)
+    (funcall benchmark megabytes)))
+
+(defun text-perf-run-batch ()
+  "Run `text-perf-run' in batch mode."
+  (text-perf-run
+   (and command-line-args-left
+        (string-to-number (pop command-line-args-left)))))
+
+;;; text-perf.el ends here
@@ -52,4 +52,48 @@
     (dotimes (i 4)
       (should (eql (aref x i) (aref y i))))))
 
+(ert-deftest gc-elapsed-statistics ()
+  (let ((gcs gcs-done)
+        (mark gc-mark-elapsed)
+        (sweep gc-sweep-elapsed))
+    (garbage-collect)
+    (should (> gcs-done gcs))
+    (should (floatp gc-last-elapsed))
+    (should (>= gc-max-elapsed gc-last-elapsed))
+    (should (>= gc-mark-elapsed mark))
+    (should (>= gc-sweep-elapsed sweep))
+    (should (<= (+ (- gc-mark-elapsed mark) (- gc-sweep-elapsed sweep))
+                gc-elapsed))))
+
+(ert-deftest gc-sweep-large-heap ()
+  "Check that sweeping a large heap keeps exactly the live objects."
+  :tags '(:expensive-test)
+  (let ((kept nil)
+        (n 1000000))
+    ;; Interleave live and dead conses and floats, and leave whole
+    ;; blocks of garbage behind, so both the per-object and the
+    ;; per-block paths of the sweeper are exercised.
+    (dotimes (i n)
+      (let ((cell (cons i (float i))))
+        (when (or (zerop (% i 3)) (< (% i 100000) 10))
+          (push cell kept))))
+    (garbage-collect)
+    (let ((garbage (make-list n 0.5)))
+      (should (= (length garbage) n)))
+    (garbage-collect)
+    (dolist (cell kept)
+      (should (= (float (car cell)) (cdr cell))))))
+
+(ert-deftest memory-fragmentation-report ()
+  (garbage-collect)
+  (let ((report (memory-fragmentation-report)))
+    (dolist (kind '(conses floats symbols intervals strings vectors))
+      (let ((entry (assq kind report)))
+        (should entry)
+        (pcase-let ((`(,_ ,blocks ,reserved ,live ,occupancy) entry))
+          (should (<= 0 live reserved))
+          (should (= (length occupancy) 11))
+          (should (= (apply #'+ (append occupancy nil)) blocks)))))
+    (should (> (nth 1 (assq 'conses report)) 0))))
+
 ;;; alloc-tests.el ends here
@@ -44,4 +44,25 @@
   (should (= (string-width "הַרְבֵּה אַהֲבָה") 9))
   (should (= (string-width "הַרְבֵּה אַהֲבָה" nil 8) 4)))
 
+(ert-deftest character-test-multibyte-conversions ()
+  "Test conversions of text with non-ASCII bytes at various offsets."
+  (dotimes (i 20)
+    (let ((prefix (make-string i ?a))
+          (suffix (make-string (% (* i 7) 19) ?b)))
+      (dolist (nonascii '("\xff" "\x80\xc3" "漢字" "é\x90"))
+        (let* ((s (concat prefix (string-to-multibyte nonascii) suffix))
+               (u (encode-coding-string s 'utf-8-emacs))
+               (m (string-to-multibyte u)))
+          (should (= (length m) (length u)))
+          (should (= (string-bytes m)
+                     (+ (length u)
+                        (seq-count (lambda (c) (>= c #x80)) u))))
+          (should (equal (string-to-unibyte m) u))
+          (should (equal (with-no-warnings (string-as-multibyte u)) s))
+          (should (= (length (format "%s" s)) (length s)))
+          (with-temp-buffer
+            (insert u)
+            (should (= (buffer-size) (length u)))
+            (should (equal (buffer-string) m))))))))
+
 ;;; character-tests.el ends here
@@ -422,6 +422,35 @@
         (should (eq (encode-coding-string s coding t) s))))))
 
 
+(ert-deftest coding-utf-8-region-offsets ()
+  "Check UTF-8 decoding and encoding of regions with non-ASCII text at
+various offsets, which tests the fast paths of the UTF-8 decoder and
+encoder against `decode-coding-string' and `encode-coding-string'."
+  (dotimes (i 24)
+    (dolist (piece '("\xe9" "é" "漢字" "😀" "\xc0\x80" "\xed\xa0\x80"
+                     "\xe6\xbc" "\r\n"))
+      (let* ((prefix (make-string i ?a))
+             (bytes (encode-coding-string piece 'utf-8-unix))
+             (expected (concat prefix
+                               (decode-coding-string bytes 'utf-8-unix)
+                               "bcdefgh")))
+        (with-temp-buffer
+          (set-buffer-multibyte nil)
+          (insert prefix bytes "bcdefgh")
+          (should (equal (decode-coding-region (point-min) (point-max)
+                                               'utf-8-unix t)
+                         expected)))
+        (with-temp-buffer
+          (insert prefix (string-to-multibyte bytes) "bcdefgh")
+          (decode-coding-region (point-min) (point-max) 'utf-8-unix)
+          (should (equal (buffer-string) expected)))
+        (with-temp-buffer
+          (insert expected)
+          (encode-coding-region (point-min) (point-max) 'utf-8-unix)
+          (should (equal (buffer-string)
+                         (string-to-multibyte
+                          (encode-coding-string expected 'utf-8-unix)))))))))
+
 (ert-deftest coding-check-coding-systems-region ()
   (should (equal (check-coding-systems-region "aå" nil '(utf-8))
                  nil))
@@ -654,6 +654,44 @@ sufficiently large to avoid truncation."
       (should (= (point-min) m1))
       (should (= (+ (point-min) 3) m2)))))
 
+(ert-deftest editfns-tests--replace-regions ()
+  (with-temp-buffer
+    (insert "source")
+    (let ((source (current-buffer)))
+      (with-temp-buffer
+        (setq buffer-undo-list nil)
+        (insert "one two three four")
+        (goto-char 15)
+        (let ((m (copy-marker 10))
+              (calls nil))
+          (add-hook 'before-change-functions
+                    (lambda (beg end) (push (list 'before beg end) calls))
+                    nil t)
+          (add-hook 'after-change-functions
+                    (lambda (beg end len)
+                      (push (list 'after beg end len) calls))
+                    nil t)
+          (replace-regions `((1 4 "1")
+                             (5 5 "and ")
+                             (9 14 ,(vector source 1 4))
+                             (14 14 "!")))
+          (should (equal (buffer-string) "1 and two sou! four"))
+          ;; Point stays after the last region, and a marker in a
+          ;; replaced region moves to its beginning.
+          (should (looking-at "four"))
+          (should (= m 11))
+          (should (equal calls '((after 1 15 13) (before 1 14))))
+          (undo-boundary)
+          (primitive-undo 1 (cdr buffer-undo-list))
+          (should (equal (buffer-string) "one two three four"))))
+      (with-temp-buffer
+        (insert "abcdef")
+        (replace-regions [])
+        (should-error (replace-regions '((3 5 "x") (2 4 "y"))))
+        (should-error (replace-regions '((1 2 "x") (4 100 "y"))))
+        (should-error (replace-regions '((1 2 x))))
+        (should (equal (buffer-string) "abcdef"))))))
+
 (ert-deftest delete-region-undo-markers-1 ()
   "Make sure we don't end up with freed markers reachable from Lisp."
   ;; https://debbugs.gnu.org/cgi/bugreport.cgi?bug=30931#40
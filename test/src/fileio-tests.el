@@ -277,5 +277,21 @@ Also check that an encoding error can appear in a symlink."
       ;; We should have prompted about the supersession threat.
       (should asked))))
 
+(ert-deftest fileio-tests--insert-file-contents-elapsed ()
+  "Test that `insert-file-contents' records the times of its phases."
+  (ert-with-temp-file file
+    :text "héllo\nworld\n"
+    (let ((insert-file-contents-elapsed nil))
+      (with-temp-buffer
+        (insert-file-contents file))
+      (should-not insert-file-contents-elapsed)
+      (setq insert-file-contents-elapsed t)
+      (with-temp-buffer
+        (insert-file-contents file)
+        (should (equal (buffer-string) "héllo\nworld\n")))
+      (should (length= insert-file-contents-elapsed 4))
+      (should (seq-every-p (lambda (time) (and (floatp time) (>= time 0)))
+                           insert-file-contents-elapsed)))))
+
 
 ;;; fileio-tests.el ends here
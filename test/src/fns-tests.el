@@ -1427,6 +1427,28 @@
   (should (string-match "\\`[0-9a-f]\\{128\\}\\'"
                         (secure-hash 'sha512 'iv-auto 100))))
 
+(ert-deftest test-secure-hash-buffer ()
+  ;; The text of a buffer that needs no encoding is hashed in place;
+  ;; check that this gives the digest of the encoded text wherever the
+  ;; gap is.
+  (dolist (multibyte '(nil t))
+    (with-temp-buffer
+      (set-buffer-multibyte multibyte)
+      (insert "foo\nbar\nbaz")
+      (dolist (gap '(1 5 8 12))
+        (goto-char gap)
+        (insert "x")
+        (delete-char -1)
+        (dolist (coding '(utf-8-unix utf-8-dos))
+          ;; The text of a unibyte buffer is never encoded.
+          (let ((used (if multibyte coding 'raw-text)))
+            (should (equal (md5 (current-buffer) 2 11 coding)
+                           (md5 (encode-coding-string "oo\nbar\nba" used))))
+            (should (equal (md5 (current-buffer) nil nil coding)
+                           (md5 (encode-coding-string
+                                 "foo\nbar\nbaz" used)))))))
+      (should (equal (buffer-string) "foo\nbar\nbaz")))))
+
 (ert-deftest test-vector-delete ()
   (let ((v1 (make-vector 1000 1)))
     (should (equal (delete t (vector nil t)) [nil]))
@@ -1636,6 +1658,71 @@
     (should-error (line-number-at-pos -1))
     (should-error (line-number-at-pos 100))))
 
+(ert-deftest fns-tests-string-char-byte-large ()
+  ;; Random access into a large multibyte string.  Its characters are
+  ;; alternately 1 and 3 bytes long, so that filling it with 2-byte
+  ;; characters changes where they start.
+  (let* ((chars (mapcar (lambda (i) (if (zerop (% i 2)) ?ᴀ ?a))
+                        (number-sequence 0 49999)))
+         (string (apply #'string chars))
+         (vector (vconcat chars)))
+    (dolist (i '(40000 3000 49999 0 25000 1023 1024 1025 7777))
+      (should (eq (aref string i) (aref vector i))))
+    (fillarray string ?é)
+    (dolist (i '(40001 3001 49999 0 25000))
+      (should (eq (aref string i) ?é)))))
+
+(defun fns-tests--count-lines (beg end)
+  "Count the newlines between BEG and END the slow way."
+  (let ((n 0))
+    (save-excursion
+      (goto-char beg)
+      (while (search-forward "\n" end t)
+        (setq n (1+ n))))
+    n))
+
+(ert-deftest test-line-number-at-position-large ()
+  ;; Exercise the line index with a buffer spanning many checkpoints,
+  ;; multibyte text, insertions, deletions and narrowing.
+  (with-temp-buffer
+    (dotimes (i 20000)
+      (insert (format "line %d%s\n" i (if (zerop (% i 7)) " αβγ" ""))))
+    (let ((check
+           (lambda ()
+             (dolist (pos (list (point-min) (point-max) 1 (buffer-size)
+                                (/ (buffer-size) 3) (/ (buffer-size) 2)
+                                (- (buffer-size) 100)))
+               (should (= (line-number-at-pos pos t)
+                          (1+ (fns-tests--count-lines 1 pos)))))
+             (dolist (line '(1 2 100 5000 19999 20000 20001))
+               (should (= (line-number-position line t)
+                          (save-excursion
+                            (goto-char (point-min))
+                            (forward-line (1- line))
+                            (point))))))))
+      (funcall check)
+      (goto-char (/ (buffer-size) 4))
+      (insert "one\ntwo\nthree ωψ\n")
+      (funcall check)
+      (delete-region (/ (buffer-size) 5) (+ (/ (buffer-size) 5) 30000))
+      (funcall check)
+      (subst-char-in-region (point-min) (/ (buffer-size) 2) ?\n ?x)
+      (funcall check)
+      (goto-char (point-max))
+      (insert (make-string 50000 ?\n))
+      (funcall check)
+      (should (= (line-number-position 0 t) 1))
+      (should (= (line-number-position (* 2 (buffer-size)) t)
+                 (point-max)))
+      (narrow-to-region (/ (buffer-size) 3) (/ (buffer-size) 2))
+      (should (= (line-number-at-pos (point-max))
+                 (1+ (fns-tests--count-lines (point-min) (point-max)))))
+      (should (= (line-number-position 1) (point-min)))
+      (should (= (line-number-position 1000000) (point-max)))
+      (let ((pos (line-number-position 10)))
+        (should (= (line-number-at-pos pos) 10))
+        (should (eq (char-before pos) ?\n))))))
+
 (defun fns-tests-concat (&rest args)
   ;; Dodge the byte-compiler's partial evaluation of `concat' with
   ;; constant arguments.
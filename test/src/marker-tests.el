@@ -70,4 +70,100 @@
         (should-not (memq m3 ms))
         (should (all (lambda (m) (eq (marker-buffer m) (current-buffer))) ms))))))
 
+(ert-deftest marker-position-bytes-large-buffer ()
+  "Character and byte positions agree far from point and markers."
+  (with-temp-buffer
+    (dotimes (i 20000)
+      (insert (if (zerop (% i 3)) "αβγ δ\n" "abcdef\n")))
+    (let ((check
+           (lambda ()
+             (goto-char (point-min))
+             (dolist (pos (list (/ (buffer-size) 3) (/ (buffer-size) 2)
+                                (- (point-max) 9000) (+ (point-min) 9000)))
+               (let ((bytes (1+ (string-bytes
+                                 (buffer-substring (point-min) pos)))))
+                 (should (= (position-bytes pos) bytes))
+                 (should (= (byte-to-position bytes) pos)))))))
+      (funcall check)
+      (goto-char (/ (buffer-size) 4))
+      (insert "ωψ\n")
+      (funcall check)
+      (delete-region (/ (buffer-size) 5) (+ (/ (buffer-size) 5) 100))
+      (funcall check)
+      (goto-char (point-min))
+      (while (search-forward "bcd" nil t)
+        (replace-match "λ"))
+      (funcall check)
+      (set-buffer-multibyte nil)
+      (funcall check)
+      (set-buffer-multibyte t)
+      (funcall check))))
+
+;; Compare the positions of markers after random edits with those
+;; computed by a simple model.
+(ert-deftest marker-random-edits ()
+  "Markers follow insertions, deletions and replacements."
+  (with-temp-buffer
+    (random "marker-random-edits")
+    (insert (make-string 50 ?a))
+    (let ((markers nil)
+          (random-text
+           (lambda ()
+             (let ((chars nil))
+               (dotimes (_ (random 5))
+                 (push (aref "aé漢" (random 3)) chars))
+               (apply #'string chars)))))
+      (dotimes (i 3000)
+        (let* ((from (1+ (random (point-max))))
+               (to (min (point-max) (+ from (random 6))))
+               (entry (nth (random (max 1 (length markers))) markers)))
+          (pcase (random 6)
+            (0 (push (cons (copy-marker from (zerop (random 2))) from)
+                     markers))
+            (1 (let ((text (funcall random-text))
+                     (before-markers (zerop (random 4))))
+                 (goto-char from)
+                 (if before-markers
+                     (insert-before-markers text)
+                   (insert text))
+                 (dolist (e markers)
+                   (when (or (> (cdr e) from)
+                             (and (= (cdr e) from)
+                                  (or before-markers
+                                      (marker-insertion-type (car e)))))
+                     (setcdr e (+ (cdr e) (length text)))))))
+            (2 (delete-region from to)
+               (dolist (e markers)
+                 (setcdr e (cond ((> (cdr e) to) (- (cdr e) (- to from)))
+                                 ((> (cdr e) from) from)
+                                 (t (cdr e))))))
+            (3 (when (< from to)
+                 (let ((text (funcall random-text)))
+                   (goto-char from)
+                   (looking-at (format ".\\{%d\\}" (- to from)))
+                   (replace-match text t t)
+                   (dolist (e markers)
+                     (setcdr e (cond ((>= (cdr e) to)
+                                      (+ (cdr e) (- (length text)
+                                                    (- to from))))
+                                     ((> (cdr e) from) from)
+                                     (t (cdr e))))))))
+            (4 (when entry
+                 (set-marker (car entry) from)
+                 (setcdr entry from)))
+            (5 (when entry
+                 (set-marker (car entry) nil)
+                 (setq markers (delq entry markers)))))
+          (dolist (e markers)
+            (should (equal (marker-position (car e)) (cdr e))))
+          (when (zerop (% i 100))
+            (let ((in (markers-in (point-min) (point-max))))
+              (dolist (e markers)
+                (should (memq (car e) in))
+                (goto-char (car e))
+                (should (= (position-bytes (point))
+                           (1+ (string-bytes
+                                (buffer-substring (point-min)
+                                                  (point))))))))))))))
+
 ;;; marker-tests.el ends here
@@ -38,6 +38,88 @@
     (should-not (profiler-memory-log))
     (when was-running (profiler-memory-start))))
 
+(ert-deftest profiler-tests-memory-profiler-object-kinds ()
+  (let ((was-running (profiler-memory-running-p))
+        (profiler-memory-sampling-interval 1)
+        (junk nil))
+    (profiler-memory-stop)
+    (profiler-memory-log)               ;flush the log
+    (profiler-memory-start)
+    (unwind-protect
+        (dotimes (i 100)
+          (setq junk (cons (make-string 10 ?a) (list i (float i)))))
+      (profiler-memory-stop))
+    (let ((log (profiler-memory-log))
+          (cons-size (nth 1 (assq 'conses (garbage-collect))))
+          (size-class nil)
+          (seen nil))
+      (should (hash-table-p log))
+      (maphash
+       (lambda (backtrace _count)
+         (when (> (length backtrace) 1)
+           (let ((kind (aref backtrace 0)))
+             (push kind seen)
+             (when (memq kind '(conses strings floats))
+               (setq size-class (symbol-name (aref backtrace 1)))
+               (should (string-match "\\`\\([0-9]+\\)-\\([0-9]+\\) bytes\\'"
+                                     size-class))
+               (let ((low (string-to-number (match-string 1 size-class)))
+                     (high (string-to-number (match-string 2 size-class))))
+                 (should (= (1+ high) (* 2 low)))
+                 (should (= (logand low (1- low)) 0))
+                 (when (eq kind 'conses)
+                   (should (<= low cons-size high))))))))
+       log)
+      (should (memq 'conses seen))
+      (should (memq 'strings seen))
+      (should (memq 'floats seen)))
+    (when was-running (profiler-memory-start))))
+
+(ert-deftest profiler-tests-event-log ()
+  (let ((profiler-record-events t))
+    (garbage-collect)
+    (let* ((log (json-parse-string (profiler-event-log)
+                                   :object-type 'alist))
+           (events (alist-get 'traceEvents log))
+           (gc-events (seq-filter
+                       (lambda (event)
+                         (equal (alist-get 'name event) "garbage-collect"))
+                       events))
+           (last-gc (car (last gc-events))))
+      (should (> (length gc-events) 1))
+      (should (equal (alist-get 'ph last-gc) "E"))
+      (should (natnump (alist-get 'conses (alist-get 'args last-gc))))
+      (should (seq-every-p (lambda (event)
+                             (member (alist-get 'ph event) '("B" "E")))
+                           events)))))
+
+(ert-deftest profiler-tests-event-log-process-output ()
+  (skip-unless (executable-find "echo"))
+  (let ((profiler-record-events t))
+    (with-temp-buffer
+      ;; A process without a filter of its own has its output inserted
+      ;; by C code, which is logged too.
+      (let ((proc (make-process :name "profiler-tests-echo"
+                                :command '("echo" "hello")
+                                :buffer (current-buffer)
+                                :sentinel #'ignore)))
+        (while (accept-process-output proc 5))
+        (should (equal (buffer-string) "hello\n"))
+        (let* ((log (json-parse-string (profiler-event-log)
+                                       :object-type 'alist))
+               (events (seq-filter
+                        (lambda (event)
+                          (equal (alist-get 'name event) "process-filter"))
+                        (alist-get 'traceEvents log)))
+               (begin (car (last events 2))))
+          (should (equal (alist-get 'ph begin) "B"))
+          (should (equal (alist-get 'pid (alist-get 'args begin))
+                         (process-id proc)))
+          (should (equal (alist-get 'ph (car (last events))) "E"))
+          (should (seq-every-p (lambda (event)
+                                 (eql (alist-get 'tid event) 1))
+                               events)))))))
+
 (defconst profiler-tests-cpu-sampling-interval 1000000)
 
 (ert-deftest profiler-tests-cpu-profiler ()
@@ -55,4 +137,92 @@
       (profiler-cpu-start (or (bound-and-true-p profiler-sampling-interval)
                               profiler-tests-cpu-sampling-interval)))))
 
+(ert-deftest profiler-tests-cpu-profiler-c-frames ()
+  (skip-unless (fboundp 'profiler-cpu-start))
+  (let ((was-running (profiler-cpu-running-p))
+        (string (make-string 100000 ?a))
+        (matching nil))
+    (profiler-cpu-stop)
+    (profiler-cpu-log)                  ;flush the log
+    (profiler-cpu-start 1000000)
+    (unwind-protect
+        (let ((end (+ (float-time) 0.5)))
+          (while (< (float-time) end)
+            (string-match "b" string)))
+      (profiler-cpu-stop))
+    (maphash (lambda (backtrace _count)
+               (when (eq (aref backtrace 0) (intern "Regexp matching"))
+                 (setq matching t)))
+             (profiler-cpu-log))
+    (should matching)
+    (when was-running
+      (profiler-cpu-start (or (bound-and-true-p profiler-sampling-interval)
+                              profiler-tests-cpu-sampling-interval)))))
+
+(ert-deftest profiler-tests-cpu-profiler-wall-clock ()
+  (skip-unless (fboundp 'profiler-cpu-start))
+  (let ((was-running (profiler-cpu-running-p))
+        (blocked nil))
+    (profiler-cpu-stop)
+    (profiler-cpu-log)                  ;flush the log
+    (skip-unless (ignore-errors (profiler-cpu-start 1000000 t)))
+    (unwind-protect
+        (sleep-for 0.2)
+      (profiler-cpu-stop))
+    (maphash (lambda (backtrace _count)
+               (when (eq (aref backtrace 0) (intern "Blocked in select"))
+                 (setq blocked t)))
+             (profiler-cpu-log))
+    (should blocked)
+    (when was-running
+      (profiler-cpu-start (or (bound-and-true-p profiler-sampling-interval)
+                              profiler-tests-cpu-sampling-interval)))))
+
+(ert-deftest profiler-tests-cpu-profiler-lock-contention ()
+  (skip-unless (and (fboundp 'profiler-cpu-start) (featurep 'threads)))
+  (let ((was-running (profiler-cpu-running-p))
+        (waited nil))
+    (profiler-cpu-stop)
+    (profiler-cpu-log)                  ;flush the log
+    (skip-unless (ignore-errors (profiler-cpu-start 1000000 t)))
+    (unwind-protect
+        (let ((thread (make-thread
+                       (lambda ()
+                         ;; Keep the global lock for a while.
+                         (let ((end (+ (float-time) 0.2)))
+                           (while (< (float-time) end)))))))
+          ;; Let THREAD run, and wait for it to give the lock back.
+          (thread-yield)
+          (thread-join thread))
+      (profiler-cpu-stop))
+    ;; The main thread was sampled while waiting for the lock, under
+    ;; its own backtrace.
+    (maphash (lambda (backtrace _count)
+               (when (and (eq (aref backtrace 0) (intern "Waiting for lock"))
+                          (seq-contains-p backtrace 'thread-yield))
+                 (setq waited t)))
+             (profiler-cpu-log))
+    (should waited)
+    (when was-running
+      (profiler-cpu-start (or (bound-and-true-p profiler-sampling-interval)
+                              profiler-tests-cpu-sampling-interval)))))
+
+(ert-deftest profiler-tests-perf-profiler ()
+  (skip-unless (fboundp 'profiler-perf-start))
+  (skip-unless (not (profiler-cpu-running-p)))
+  (profiler-perf-log)                   ;flush the log
+  (skip-unless (ignore-errors (profiler-perf-start 'instructions 100000)))
+  (unwind-protect
+      (progn
+        (should (profiler-perf-running-p))
+        (should-error (profiler-cpu-start 1000000))
+        (let ((end (+ (float-time) 0.2)))
+          (while (< (float-time) end)
+            (make-list 100 nil))))
+    (should (profiler-perf-stop)))
+  (should-not (profiler-perf-running-p))
+  (should (hash-table-p (profiler-perf-log)))
+  (should-error (profiler-perf-start 'no-such-event 100000))
+  (should-error (profiler-perf-start 'instructions 0)))
+
 ;;; profiler-tests.el ends here
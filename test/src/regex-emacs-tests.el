@@ -909,8 +909,46 @@ This evaluates the TESTS test cases from glibc."
     (should (string-match "\\(aa*\\|b\\)*c" "ababc"))
     (should (string-match " \\sw*\\bfoo" " foo"))
     (should (string-match ".*\\>" "hello "))
+    ;; `.' cannot match what a loop over newlines matches.
+    (erase-buffer)
+    (insert (make-string 1000000 ?\n) "x")
+    (goto-char (point-min))
+    (should (looking-at "\n*."))
+    (should (looking-at "[\n]*."))
+    (should (string-match "\\`\n*\\(.\\|\n\\)" "\n\n"))
     ))
 
+(ert-deftest regexp-tests-literal-prefix ()
+  ;; Forward searches skip to the literal text that every match of
+  ;; these patterns begins with.  Check that they find it wherever
+  ;; the gap is, including when the gap splits it.
+  (with-temp-buffer
+    (insert "é foobar foo-bar\nfoobaz")
+    (let ((case-fold-search nil))
+      (dotimes (i (buffer-size))
+        (goto-char (1+ i))
+        (insert "x")
+        (delete-char -1)
+        (pcase-dolist (`(,regexp . ,starts)
+                       '(("fooba?" 3 18)
+                         ("\\<foo" 3 10 18)
+                         ("^foo" 18)
+                         ("\\(fo\\)ob" 3 18)
+                         ("é f" 1)
+                         ("r\nf" 16)))
+          (goto-char (point-min))
+          (let ((found nil))
+            (while (re-search-forward regexp nil t)
+              (push (match-beginning 0) found))
+            (should (equal (cons regexp (nreverse found))
+                           (cons regexp starts))))))))
+  ;; Patterns and text that differ in multibyteness.
+  (let ((case-fold-search nil))
+    (should (= (string-match "\\<foob" "é foob") 2))
+    (should (= (string-match "oo\351" "\351foo\351") 2))
+    (should (= (string-match "fo\351" (string-to-multibyte "\351fo\351")) 1))
+    (should-not (string-match "fo\351" (string-to-multibyte "\351fo")))))
+
 (ert-deftest regexp-tests-zero-width-assertion-repetition ()
   ;; Check compatibility behavior with repetition operators after
   ;; certain zero-width assertions (bug#64128).
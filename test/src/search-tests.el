@@ -79,4 +79,186 @@
         ;;(should (equal (match-end 2) beg4))
         ))))
 
+(ert-deftest search-test--regexp-cache ()
+  (let* ((case-fold-search nil)
+         (regexps (mapcar (lambda (i) (format "x%d\\(y\\|z\\)" i))
+                          (number-sequence 1 100))))
+    (dolist (re regexps)
+      (string-match re "x1y"))
+    (pcase-let ((`(,hits ,misses ,size) (regexp-cache-statistics)))
+      (should (>= size 100))
+      ;; All the regexps are still in the cache, so matching them again
+      ;; compiles none of them.
+      (dolist (re regexps)
+        (string-match re "x1z"))
+      (should (equal (regexp-cache-statistics)
+                     (list (+ hits 100) misses size)))
+      ;; A different translation table needs a different compiled
+      ;; regexp.
+      (let ((case-fold-search t))
+        (should (eq (string-match (car regexps) "X1Z") 0)))
+      (should (equal (nth 1 (regexp-cache-statistics)) (1+ misses))))))
+
+(ert-deftest search-test--regexp-compile ()
+  (let* ((case-fold-search nil)
+         (re (regexp-compile "fo+\\(ba\\)r")))
+    (should (compiled-regexp-p re))
+    (should-not (compiled-regexp-p "fo+\\(ba\\)r"))
+    (should (eq (regexp-compile re) re))
+    (should (eq (string-match re "xfooobar") 1))
+    (should (equal (match-string 1 "xfooobar") "ba"))
+    (should-not (string-match re "xFOOBAR"))
+    (let ((case-fold-search t))
+      (should (eq (string-match re "xFOOBAR") 1)))
+    (with-temp-buffer
+      (insert "a foobar foooobar")
+      (goto-char (point-min))
+      (should (eq (re-search-forward re nil t) 9))
+      (should (eq (re-search-forward re nil t) 18))
+      (should (eq (re-search-backward re nil t) 10))
+      (should (looking-at re))
+      (should (equal (match-beginning 1) 15))))
+  ;; A literal regexp is searched for as a string.
+  (with-temp-buffer
+    (insert "xyz xyz")
+    (goto-char (point-min))
+    (should (eq (re-search-forward (regexp-compile "yz") nil t) 4)))
+  ;; `looking-back' builds a larger regexp from the pattern.
+  (should (equal (compiled-regexp-pattern (regexp-compile "o+b")) "o+b"))
+  (should-error (compiled-regexp-pattern "o+b") :type 'wrong-type-argument)
+  (with-temp-buffer
+    (insert "a foobar")
+    (should (looking-back (regexp-compile "o+\\(ba\\)r") (point-min)))
+    (should (equal (match-beginning 1) 6)))
+  (should-error (regexp-compile "\\(") :type 'invalid-regexp)
+  (should-error (string-match 'foo "") :type 'wrong-type-argument))
+
+(ert-deftest search-test--regexp-compile-syntax ()
+  ;; A compiled regexp that depends on the syntax table is compiled
+  ;; again after the syntax table changes.
+  (with-temp-buffer
+    (set-syntax-table (make-syntax-table))
+    (let ((re (regexp-compile "a\\s_b")))
+      (insert "a-b")
+      (goto-char (point-min))
+      (modify-syntax-entry ?- "_")
+      (should (looking-at re))
+      (modify-syntax-entry ?- ".")
+      (should-not (looking-at re)))))
+
+;; Literal searches look at the text before and after the gap
+;; separately, and at the text around the gap byte by byte.
+(ert-deftest search-test--literal-gap ()
+  (dolist (multibyte '(t nil))
+    (with-temp-buffer
+      (set-buffer-multibyte multibyte)
+      (insert "foo Needle bar needle baz needlE")
+      (dotimes (gap (buffer-size))
+        ;; Move the gap.
+        (goto-char (1+ gap))
+        (insert "x")
+        (delete-char -1)
+        (goto-char (point-min))
+        (let ((case-fold-search nil))
+          (should (eq (search-forward "needle" nil t) 22))
+          (should (eq (match-beginning 0) 16))
+          (goto-char (point-min))
+          (should-not (search-forward "needle" nil t 2))
+          (goto-char (point-min))
+          (should (eq (search-forward "needle" 21 t) nil)))
+        (goto-char (point-min))
+        (let ((case-fold-search t))
+          (should (eq (search-forward "NEEDLE" nil t 3) 33))
+          (should (eq (match-beginning 0) 27))
+          (goto-char (point-min))
+          (let ((inhibit-changing-match-data t))
+            (should (eq (search-forward "needle" nil t 2) 22)))
+          (should (eq (match-beginning 0) 27))
+          (goto-char (point-min))
+          (should (eq (search-forward "r n" nil t) 17)))))))
+
+;; Replacements by text of the same size are written over the old
+;; text without moving the gap, even when the number of characters
+;; changes.
+(ert-deftest search-test--replace-match-same-size ()
+  (pcase-dolist (`(,old ,new) '(("é" "ab") ("ab" "é") ("xy" "zw")))
+    (dotimes (gap 8)
+      (with-temp-buffer
+        (buffer-enable-undo)
+        (insert "12 " old " 34")
+        ;; Move the gap.
+        (goto-char (1+ gap))
+        (insert "x")
+        (delete-char -1)
+        (let ((before (copy-marker 4))
+              (after (copy-marker (- (point-max) 1)))
+              (changes nil))
+          (goto-char (point-min))
+          (search-forward old)
+          (undo-boundary)
+          (let ((after-change-functions
+                 (list (lambda (beg end len)
+                         (push (list beg end len) changes)))))
+            (replace-match new t t))
+          (should (equal (buffer-string) (concat "12 " new " 34")))
+          (should (equal changes `((4 ,(+ 4 (length new)) ,(length old)))))
+          (should (= (point) (+ 4 (length new))))
+          (should (= before 4))
+          (should (= after (- (point-max) 1)))
+          (should (equal (char-after after) ?4))
+          (dotimes (i (buffer-size))
+            (should (= (position-bytes (1+ i))
+                       (1+ (string-bytes (buffer-substring 1 (1+ i)))))))
+          (primitive-undo 1 buffer-undo-list)
+          (should (equal (buffer-string) (concat "12 " old " 34"))))))))
+
+;; Case-folded patterns with non-ASCII characters are searched for by
+;; simple_search, which skips characters that cannot begin or end a
+;; match without decoding them.
+(ert-deftest search-test--case-fold-non-ascii ()
+  (let ((case-fold-search t))
+    (with-temp-buffer
+      ;; The second byte of U+17C0 is also the last byte of "ß".
+      (insert "Strasse STRAẞE aé straße É xÉé ßaẞ ẞAß éẞ STRASSE Éß"
+              " ßaៀ ßaៀß")
+      ;; "É" and "aé s" are searched for by boyer_moore, the others,
+      ;; whose characters' case-equivalents are further apart, by
+      ;; simple_search.
+      (dolist (pattern '("Straße" "É" "ßaß" "e STRAẞ" "Éß" "aé s"))
+        (let ((expected nil))
+          ;; Find the matches with the regexp engine.
+          (goto-char (point-min))
+          (while (re-search-forward (regexp-quote pattern) nil t)
+            (push (match-beginning 0) expected))
+          (setq expected (nreverse expected))
+          (should expected)
+          (dotimes (gap (1+ (buffer-size)))
+            ;; Move the gap.
+            (goto-char (1+ gap))
+            (insert "x")
+            (delete-char -1)
+            (let ((forward nil)
+                  (backward nil))
+              (goto-char (point-min))
+              (while (search-forward pattern nil t)
+                (push (match-beginning 0) forward)
+                (should (eq (point) (match-end 0)))
+                (should (eq (- (match-end 0) (match-beginning 0))
+                            (length pattern))))
+              (goto-char (point-max))
+              (while (search-backward pattern nil t)
+                (push (match-beginning 0) backward)
+                (should (eq (point) (match-beginning 0))))
+              (should (equal (nreverse forward) expected))
+              (should (equal backward expected))
+              ;; Bounds and counts, too.
+              (goto-char (point-min))
+              (should (eq (search-forward pattern (1- (+ (car expected)
+                                                         (length pattern)))
+                                          t)
+                          nil))
+              (goto-char (point-max))
+              (should (eq (search-backward pattern nil t (length expected))
+                          (car expected))))))))))
+
 ;;; search-tests.el ends here